@@ -12,6 +12,13 @@
  * - Diagnostics Tests
  * - Configuration Tests
  * - Frame Format Tests
+ * - Read Chaining Tests (ReadRegs, ReadSample)
+ * - Continuous / Burst Read Tests
+ * - Asynchronous Read Tests
+ * - Write Chain / Deferred Verify Tests
+ * - Config Cache / Transaction Tests
+ * - Multi-Device Tests (bus manager, daisy chain)
+ * - Sampler Tests (sampler thread, observer, multi-turn counter)
  * - Error Handling Tests
  *
  * @author N3b3x
@@ -21,13 +28,21 @@
 
 #include "esp_log.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include <array>
+#include <chrono>
 #include <cstdlib>
 #include <memory>
 #include <stdio.h>
 
 #include "../../../inc/as5047u.hpp"
+#include "../../../inc/as5047u_bus_manager.hpp"
+#include "../../../inc/as5047u_daisy_chain.hpp"
+#include "../../../inc/as5047u_multiturn.hpp"
+#include "../../../inc/as5047u_observer.hpp"
+#include "../../../inc/as5047u_sampler.hpp"
 #include "esp32_as5047u_bus.hpp"
 #include "esp32_as5047u_test_config.hpp"
 #include "TestFramework.h"
@@ -45,6 +60,13 @@ static constexpr bool ENABLE_VELOCITY_READING_TESTS = true;
 static constexpr bool ENABLE_DIAGNOSTICS_TESTS = true;
 static constexpr bool ENABLE_CONFIGURATION_TESTS = true;
 static constexpr bool ENABLE_FRAME_FORMAT_TESTS = true;
+static constexpr bool ENABLE_READ_CHAIN_TESTS = true;
+static constexpr bool ENABLE_BURST_READ_TESTS = true;
+static constexpr bool ENABLE_ASYNC_READ_TESTS = true;
+static constexpr bool ENABLE_WRITE_CHAIN_TESTS = true;
+static constexpr bool ENABLE_CONFIG_CACHE_TESTS = true;
+static constexpr bool ENABLE_MULTI_DEVICE_TESTS = true;
+static constexpr bool ENABLE_SAMPLER_TESTS = true;
 static constexpr bool ENABLE_ERROR_HANDLING_TESTS = true;
 
 //=============================================================================
@@ -436,6 +458,456 @@ static bool test_crc_verification() noexcept {
   return all_ok;
 }
 
+//=============================================================================
+// READ CHAINING TESTS
+//=============================================================================
+
+/// Largest angle difference (LSB, shortest way round) accepted between two reads at standstill.
+static constexpr int kStandstillAngleToleranceLsb = 16;
+
+static int angle_distance(uint16_t a, uint16_t b) noexcept {
+  int d = (static_cast<int>(a) - static_cast<int>(b)) & 0x3FFF;
+  return d > 0x2000 ? 0x4000 - d : d;
+}
+
+static bool test_read_regs_chain() noexcept {
+  ESP_LOGI(TAG, "Testing chained register reads (ReadRegs)...");
+
+  if (!g_encoder) {
+    ESP_LOGE(TAG, "Encoder not initialized");
+    return false;
+  }
+
+  (void)g_encoder->GetStickyErrorFlags();
+  const auto [angle, mag, agc, s2] =
+      g_encoder->ReadRegs<AS5047U_REG::ANGLECOM, AS5047U_REG::MAG, AS5047U_REG::AGC,
+                          AS5047U_REG::SETTINGS2>();
+  const AS5047U_Error chain_errors = g_encoder->GetStickyErrorFlags();
+  ESP_LOGI(TAG, "Chain: angle=%u mag=%u agc=%u settings2=0x%04X errors=0x%04X",
+           angle.bits.ANGLECOM_value, mag.bits.MAG_value, agc.bits.AGC_value, s2.value,
+           static_cast<uint16_t>(chain_errors));
+
+  // The same registers read one at a time must agree (the angle within standstill noise)
+  const uint16_t single_angle = g_encoder->GetAngle();
+  const uint8_t single_agc = g_encoder->GetAGC();
+  const auto single_s2 = g_encoder->ReadReg<AS5047U_REG::SETTINGS2>();
+  ESP_LOGI(TAG, "Single reads: angle=%u agc=%u settings2=0x%04X", single_angle, single_agc,
+           single_s2.value);
+
+  if ((static_cast<uint16_t>(chain_errors) & as5047u::COMM_ERROR_MASK) != 0U) {
+    ESP_LOGE(TAG, "Chained read reported a communication error");
+    return false;
+  }
+  if (single_s2.value != s2.value) {
+    ESP_LOGE(TAG, "SETTINGS2 mismatch: chain 0x%04X, single 0x%04X", s2.value, single_s2.value);
+    return false;
+  }
+  if (angle_distance(single_angle, angle.bits.ANGLECOM_value) > kStandstillAngleToleranceLsb) {
+    ESP_LOGW(TAG, "Angle moved between chained and single read (magnet moving?)");
+  }
+
+  ESP_LOGI(TAG, "Chained register read test passed");
+  return true;
+}
+
+static bool test_read_sample() noexcept {
+  ESP_LOGI(TAG, "Testing chained sample read (ReadSample)...");
+
+  if (!g_encoder) {
+    ESP_LOGE(TAG, "Encoder not initialized");
+    return false;
+  }
+
+  const as5047u::EncoderSample sample = g_encoder->ReadSample();
+  ESP_LOGI(TAG, "Sample: angle=%u raw=%u velocity=%d errors=0x%04X", sample.angle,
+           sample.raw_angle, sample.velocity, static_cast<uint16_t>(sample.errors));
+
+  if ((static_cast<uint16_t>(sample.errors) & as5047u::COMM_ERROR_MASK) != 0U) {
+    ESP_LOGE(TAG, "ReadSample reported a communication error");
+    return false;
+  }
+
+  ESP_LOGI(TAG, "Chained sample read test passed");
+  return true;
+}
+
+//=============================================================================
+// CONTINUOUS / BURST READ TESTS
+//=============================================================================
+
+static bool test_continuous_read() noexcept {
+  ESP_LOGI(TAG, "Testing pipelined continuous angle reads...");
+
+  if (!g_encoder) {
+    ESP_LOGE(TAG, "Encoder not initialized");
+    return false;
+  }
+
+  (void)g_encoder->GetStickyErrorFlags();
+  const uint16_t reference = g_encoder->GetAngle();
+  (void)g_encoder->GetAngleContinuous(); // primes the pipeline
+  int max_distance = 0;
+  for (int i = 0; i < 100; ++i) {
+    const int d = angle_distance(g_encoder->GetAngleContinuous(), reference);
+    max_distance = d > max_distance ? d : max_distance;
+  }
+  const AS5047U_Error errors = g_encoder->GetStickyErrorFlags();
+  ESP_LOGI(TAG, "100 continuous reads: max distance from %u = %d LSB, errors=0x%04X", reference,
+           max_distance, static_cast<uint16_t>(errors));
+
+  if ((static_cast<uint16_t>(errors) & as5047u::COMM_ERROR_MASK) != 0U) {
+    ESP_LOGE(TAG, "Continuous reads reported a communication error");
+    return false;
+  }
+  if (max_distance > kStandstillAngleToleranceLsb) {
+    ESP_LOGW(TAG, "Angle spread of %d LSB (magnet moving?)", max_distance);
+  }
+
+  ESP_LOGI(TAG, "Continuous read test passed");
+  return true;
+}
+
+static bool test_burst_read() noexcept {
+  ESP_LOGI(TAG, "Testing burst angle capture (ReadAngles)...");
+
+  if (!g_encoder) {
+    ESP_LOGE(TAG, "Encoder not initialized");
+    return false;
+  }
+
+  // Longer than one frame list, so the chunking path runs too
+  static std::array<uint16_t, as5047u::AS5047U<Esp32As5047uSpiBus>::BURST_CHUNK_FRAMES + 36> angles{};
+  std::array<uint8_t, (angles.size() + 7) / 8> error_bitmap{};
+  const int64_t start_us = esp_timer_get_time();
+  const std::size_t bad = g_encoder->ReadAngles(angles, error_bitmap);
+  const int64_t elapsed_us = esp_timer_get_time() - start_us;
+
+  uint16_t lo = angles[0];
+  uint16_t hi = angles[0];
+  for (const uint16_t a : angles) {
+    lo = a < lo ? a : lo;
+    hi = a > hi ? a : hi;
+  }
+  ESP_LOGI(TAG, "%u samples in %lld us, %u flagged, range %u..%u",
+           static_cast<unsigned>(angles.size()), static_cast<long long>(elapsed_us),
+           static_cast<unsigned>(bad), lo, hi);
+
+  if (bad != 0U) {
+    ESP_LOGE(TAG, "Burst capture flagged %u samples (first bitmap byte 0x%02X)",
+             static_cast<unsigned>(bad), error_bitmap[0]);
+    return false;
+  }
+
+  ESP_LOGI(TAG, "Burst read test passed");
+  return true;
+}
+
+//=============================================================================
+// ASYNCHRONOUS READ TESTS
+//=============================================================================
+
+static bool test_async_read() noexcept {
+  ESP_LOGI(TAG, "Testing non-blocking angle read (begin_transfer)...");
+
+  if (!g_encoder) {
+    ESP_LOGE(TAG, "Encoder not initialized");
+    return false;
+  }
+
+  (void)g_encoder->GetStickyErrorFlags();
+  const uint16_t reference = g_encoder->GetAngle();
+  if (!g_encoder->StartAsyncAngleRead()) {
+    ESP_LOGE(TAG, "StartAsyncAngleRead() refused the transfer");
+    return false;
+  }
+  if (g_encoder->StartAsyncAngleRead()) {
+    ESP_LOGE(TAG, "A second read was accepted while the first was in flight");
+    return false;
+  }
+  int polls = 0;
+  while (!g_encoder->IsAsyncReadDone()) {
+    ++polls;
+  }
+  const uint16_t angle = g_encoder->CompleteAsyncAngle();
+  const AS5047U_Error errors = g_encoder->GetStickyErrorFlags();
+  ESP_LOGI(TAG, "Async angle=%u after %d polls (sync %u), errors=0x%04X", angle, polls, reference,
+           static_cast<uint16_t>(errors));
+
+  if ((static_cast<uint16_t>(errors) & as5047u::COMM_ERROR_MASK) != 0U) {
+    ESP_LOGE(TAG, "Async read reported a communication error");
+    return false;
+  }
+  if (angle_distance(angle, reference) > kStandstillAngleToleranceLsb) {
+    ESP_LOGW(TAG, "Async and sync angle differ (magnet moving?)");
+  }
+
+  ESP_LOGI(TAG, "Async read test passed");
+  return true;
+}
+
+//=============================================================================
+// WRITE CHAIN / DEFERRED VERIFY TESTS
+//=============================================================================
+
+static bool test_write_chain() noexcept {
+  ESP_LOGI(TAG, "Testing chained writes (WriteRegs)...");
+
+  if (!g_encoder) {
+    ESP_LOGE(TAG, "Encoder not initialized");
+    return false;
+  }
+
+  const auto [zposm_orig, zposl_orig] = g_encoder->ReadRegs<AS5047U_REG::ZPOSM, AS5047U_REG::ZPOSL>();
+  AS5047U_REG::ZPOSM zposm = zposm_orig;
+  AS5047U_REG::ZPOSL zposl = zposl_orig;
+  zposm.bits.ZPOSM_bits = 0x40;  // 4096 LSB, ~90 degrees
+  zposl.bits.ZPOSL_bits = 0x00;
+
+  const bool write_ok = g_encoder->WriteRegs(zposm, zposl);
+  const uint16_t readback = g_encoder->GetZeroPosition();
+  const bool restore_ok = g_encoder->WriteRegs(zposm_orig, zposl_orig);
+  ESP_LOGI(TAG, "WriteRegs: %s, zero position read back %u (expected 4096), restore %s",
+           write_ok ? "OK" : "FAIL", readback, restore_ok ? "OK" : "FAIL");
+
+  if (!write_ok || !restore_ok || readback != 4096) {
+    ESP_LOGE(TAG, "Chained write failed");
+    return false;
+  }
+
+  ESP_LOGI(TAG, "Chained write test passed");
+  return true;
+}
+
+static bool test_deferred_verify() noexcept {
+  ESP_LOGI(TAG, "Testing deferred write verification...");
+
+  if (!g_encoder) {
+    ESP_LOGE(TAG, "Encoder not initialized");
+    return false;
+  }
+
+  const uint16_t original_zero = g_encoder->GetZeroPosition();
+  const WriteVerify original_verify = g_encoder->GetWriteVerify();
+  g_encoder->SetWriteVerify(WriteVerify::Deferred);
+
+  const bool write_a = g_encoder->SetZeroPosition(1024);
+  const bool write_b = g_encoder->SetZeroPosition(2048); // same registers: checked once, against 2048
+  const std::size_t pending = g_encoder->GetPendingWriteCount();
+  const bool verified = g_encoder->VerifyPendingWrites();
+  const std::size_t pending_after = g_encoder->GetPendingWriteCount();
+  const uint16_t readback = g_encoder->GetZeroPosition();
+
+  g_encoder->SetWriteVerify(original_verify);
+  const bool restore_ok = g_encoder->SetZeroPosition(original_zero);
+  ESP_LOGI(TAG, "Writes %s/%s, %u pending, verify %s, %u pending after, read back %u, restore %s",
+           write_a ? "OK" : "FAIL", write_b ? "OK" : "FAIL", static_cast<unsigned>(pending),
+           verified ? "OK" : "FAIL", static_cast<unsigned>(pending_after), readback,
+           restore_ok ? "OK" : "FAIL");
+
+  if (!write_a || !write_b || pending == 0U || !verified || pending_after != 0U ||
+      readback != 2048 || !restore_ok) {
+    ESP_LOGE(TAG, "Deferred write verification failed");
+    return false;
+  }
+
+  ESP_LOGI(TAG, "Deferred verify test passed");
+  return true;
+}
+
+//=============================================================================
+// CONFIG CACHE / TRANSACTION TESTS
+//=============================================================================
+
+static bool test_config_cache() noexcept {
+  ESP_LOGI(TAG, "Testing configuration cache...");
+
+  if (!g_encoder) {
+    ESP_LOGE(TAG, "Encoder not initialized");
+    return false;
+  }
+
+  const bool was_enabled = g_encoder->IsConfigCacheEnabled();
+  g_encoder->EnableConfigCache(true);
+  const bool refreshed = g_encoder->RefreshConfigCache();
+  const auto cached = g_encoder->GetHysteresis();
+  g_encoder->EnableConfigCache(false);
+  const auto uncached = g_encoder->GetHysteresis();
+  g_encoder->EnableConfigCache(was_enabled);
+  ESP_LOGI(TAG, "Refresh %s, hysteresis cached %u, from device %u", refreshed ? "OK" : "FAIL",
+           static_cast<unsigned>(cached), static_cast<unsigned>(uncached));
+
+  if (!refreshed || cached != uncached) {
+    ESP_LOGE(TAG, "Configuration cache disagrees with the device");
+    return false;
+  }
+
+  ESP_LOGI(TAG, "Configuration cache test passed");
+  return true;
+}
+
+static bool test_config_transaction() noexcept {
+  ESP_LOGI(TAG, "Testing configuration transaction (BeginConfig)...");
+
+  if (!g_encoder) {
+    ESP_LOGE(TAG, "Encoder not initialized");
+    return false;
+  }
+
+  using Hysteresis = AS5047U_REG::SETTINGS3::Hysteresis;
+  const auto [s2_orig, s3_orig] = g_encoder->ReadRegs<AS5047U_REG::SETTINGS2, AS5047U_REG::SETTINGS3>();
+  const auto original_hys = static_cast<Hysteresis>(s3_orig.bits.HYS);
+  const Hysteresis test_hys = original_hys == Hysteresis::LSB_2 ? Hysteresis::LSB_3 : Hysteresis::LSB_2;
+  const bool test_cw = s2_orig.bits.DIR != 0; // the opposite of the current direction
+
+  bool committed = false;
+  {
+    auto config = g_encoder->BeginConfig();
+    config.SetHysteresis(test_hys).SetDirection(test_cw);
+    committed = config.Commit();
+  }
+  const auto [s2_new, s3_new] = g_encoder->ReadRegs<AS5047U_REG::SETTINGS2, AS5047U_REG::SETTINGS3>();
+
+  // An aborted transaction writes nothing
+  {
+    auto config = g_encoder->BeginConfig();
+    config.SetHysteresis(original_hys);
+    config.Abort();
+  }
+  const auto s3_after_abort = g_encoder->ReadReg<AS5047U_REG::SETTINGS3>();
+
+  const bool restore_ok = g_encoder->WriteRegs(s2_orig, s3_orig);
+  ESP_LOGI(TAG, "Commit %s: HYS %u (expected %u), DIR %u (expected %u); after abort HYS %u; restore %s",
+           committed ? "OK" : "FAIL", s3_new.bits.HYS, static_cast<unsigned>(test_hys),
+           s2_new.bits.DIR, test_cw ? 0U : 1U, s3_after_abort.bits.HYS, restore_ok ? "OK" : "FAIL");
+
+  if (!committed || s3_new.bits.HYS != static_cast<uint16_t>(test_hys) ||
+      s3_after_abort.bits.HYS != s3_new.bits.HYS || !restore_ok) {
+    ESP_LOGE(TAG, "Configuration transaction failed");
+    return false;
+  }
+  if (s2_new.bits.DIR != (test_cw ? 0U : 1U)) {
+    ESP_LOGW(TAG, "DIR not toggled (see test_direction: some parts keep DIR)");
+  }
+
+  ESP_LOGI(TAG, "Configuration transaction test passed");
+  return true;
+}
+
+//=============================================================================
+// MULTI-DEVICE TESTS
+//=============================================================================
+// The test rig has one sensor, so each manager runs with N = 1 on the shared
+// bus: this checks the frame protocol of each, not the multi-device fan-out.
+
+static bool test_bus_manager() noexcept {
+  ESP_LOGI(TAG, "Testing bus manager (pipelined reads, N = 1)...");
+
+  if (!g_bus || !g_encoder) {
+    ESP_LOGE(TAG, "Encoder not initialized");
+    return false;
+  }
+
+  as5047u::AS5047UBusManager<Esp32As5047uSpiBus, 1> manager({g_bus.get()}, FrameFormat::SPI_24);
+  const uint16_t reference = g_encoder->GetAngle();
+  std::array<uint16_t, 1> angles{};
+  manager.ReadAngles(angles); // primes the pipeline
+  manager.ReadAngles(angles);
+  const AS5047U_Error errors = manager[0].GetStickyErrorFlags();
+  ESP_LOGI(TAG, "Bus manager angle=%u (direct %u), errors=0x%04X", angles[0], reference,
+           static_cast<uint16_t>(errors));
+
+  if ((static_cast<uint16_t>(errors) & as5047u::COMM_ERROR_MASK) != 0U) {
+    ESP_LOGE(TAG, "Bus manager reported a communication error");
+    return false;
+  }
+  if (angle_distance(angles[0], reference) > kStandstillAngleToleranceLsb) {
+    ESP_LOGW(TAG, "Bus manager and direct angle differ (magnet moving?)");
+  }
+
+  ESP_LOGI(TAG, "Bus manager test passed");
+  return true;
+}
+
+static bool test_daisy_chain() noexcept {
+  ESP_LOGI(TAG, "Testing daisy chain (32-bit frames, N = 1)...");
+
+  if (!g_bus || !g_encoder) {
+    ESP_LOGE(TAG, "Encoder not initialized");
+    return false;
+  }
+
+  as5047u::AS5047UDaisyChain<Esp32As5047uSpiBus, 1> chain(*g_bus);
+  const uint16_t reference = g_encoder->GetAngle();
+  std::array<uint16_t, 1> angles{};
+  const bool read_ok = chain.ReadAngles(angles);
+  const AS5047U_Error errors = chain.GetStickyErrorFlags(0);
+  ESP_LOGI(TAG, "Daisy chain read %s: angle=%u (direct %u), errors=0x%04X",
+           read_ok ? "OK" : "FAIL", angles[0], reference, static_cast<uint16_t>(errors));
+
+  if (!read_ok) {
+    ESP_LOGE(TAG, "Daisy chain read failed");
+    return false;
+  }
+  if (angle_distance(angles[0], reference) > kStandstillAngleToleranceLsb) {
+    ESP_LOGW(TAG, "Daisy chain and direct angle differ (magnet moving?)");
+  }
+
+  ESP_LOGI(TAG, "Daisy chain test passed");
+  return true;
+}
+
+//=============================================================================
+// SAMPLER TESTS
+//=============================================================================
+
+static bool test_sampler() noexcept {
+  ESP_LOGI(TAG, "Testing periodic sampler with observer and multi-turn counter...");
+
+  if (!g_encoder) {
+    ESP_LOGE(TAG, "Encoder not initialized");
+    return false;
+  }
+
+  constexpr float kRateHz = 1000.0f;
+  as5047u::AS5047USampler<as5047u::AS5047U<Esp32As5047uSpiBus>, 256> sampler(
+      *g_encoder, std::chrono::microseconds(1000));
+  if (!sampler.Start()) {
+    ESP_LOGE(TAG, "Sampler failed to start");
+    return false;
+  }
+  vTaskDelay(pdMS_TO_TICKS(200));
+  sampler.Stop();
+
+  static std::array<as5047u::EncoderSample, 256> block{};
+  const std::size_t n = sampler.Drain(block);
+  const uint32_t dropped = sampler.TakeDropped();
+  const uint32_t overruns = sampler.TakeOverruns();
+
+  as5047u::VelocityObserver observer(kRateHz, 20.0f);
+  as5047u::MultiTurnCounter position;
+  std::size_t bad = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    bad += (static_cast<uint16_t>(block[i].errors) & as5047u::COMM_ERROR_MASK) != 0U ? 1U : 0U;
+  }
+  observer.Update(std::span<const as5047u::EncoderSample>(block.data(), n));
+  position.Update(std::span<const as5047u::EncoderSample>(block.data(), n));
+  ESP_LOGI(TAG, "%u samples (%u bad, %u dropped, %u overruns); observer %.2f deg/s, turns %lld",
+           static_cast<unsigned>(n), static_cast<unsigned>(bad), static_cast<unsigned>(dropped),
+           static_cast<unsigned>(overruns), observer.GetVelocity(as5047u::VelocityUnit::DegPerSec),
+           static_cast<long long>(position.GetTurns()));
+
+  if (n < 100U || bad != 0U) {
+    ESP_LOGE(TAG, "Sampler delivered too few or corrupted samples");
+    return false;
+  }
+  if (position.TakeRejected() != 0U) {
+    ESP_LOGW(TAG, "Multi-turn counter rejected samples");
+  }
+
+  ESP_LOGI(TAG, "Sampler test passed");
+  return true;
+}
+
 //=============================================================================
 // ERROR HANDLING TESTS
 //=============================================================================
@@ -512,6 +984,37 @@ extern "C" void app_main(void) {
       RUN_TEST_IN_TASK("test_frame_format_24", test_frame_format_24, 8192, 5);
       RUN_TEST_IN_TASK("test_frame_format_32", test_frame_format_32, 8192, 5););
 
+  RUN_TEST_SECTION_IF_ENABLED(
+      ENABLE_READ_CHAIN_TESTS, "READ CHAINING TESTS",
+      RUN_TEST_IN_TASK("test_read_regs_chain", test_read_regs_chain, 8192, 5);
+      RUN_TEST_IN_TASK("test_read_sample", test_read_sample, 8192, 5););
+
+  RUN_TEST_SECTION_IF_ENABLED(
+      ENABLE_BURST_READ_TESTS, "CONTINUOUS / BURST READ TESTS",
+      RUN_TEST_IN_TASK("test_continuous_read", test_continuous_read, 8192, 5);
+      RUN_TEST_IN_TASK("test_burst_read", test_burst_read, 8192, 5););
+
+  RUN_TEST_SECTION_IF_ENABLED(ENABLE_ASYNC_READ_TESTS, "ASYNC READ TESTS",
+                              RUN_TEST_IN_TASK("test_async_read", test_async_read, 8192, 5););
+
+  RUN_TEST_SECTION_IF_ENABLED(
+      ENABLE_WRITE_CHAIN_TESTS, "WRITE CHAIN / DEFERRED VERIFY TESTS",
+      RUN_TEST_IN_TASK("test_write_chain", test_write_chain, 8192, 5);
+      RUN_TEST_IN_TASK("test_deferred_verify", test_deferred_verify, 8192, 5););
+
+  RUN_TEST_SECTION_IF_ENABLED(
+      ENABLE_CONFIG_CACHE_TESTS, "CONFIG CACHE / TRANSACTION TESTS",
+      RUN_TEST_IN_TASK("test_config_cache", test_config_cache, 8192, 5);
+      RUN_TEST_IN_TASK("test_config_transaction", test_config_transaction, 8192, 5););
+
+  RUN_TEST_SECTION_IF_ENABLED(
+      ENABLE_MULTI_DEVICE_TESTS, "MULTI-DEVICE TESTS",
+      RUN_TEST_IN_TASK("test_bus_manager", test_bus_manager, 8192, 5);
+      RUN_TEST_IN_TASK("test_daisy_chain", test_daisy_chain, 8192, 5););
+
+  RUN_TEST_SECTION_IF_ENABLED(ENABLE_SAMPLER_TESTS, "SAMPLER TESTS",
+                              RUN_TEST_IN_TASK("test_sampler", test_sampler, 8192, 5););
+
   RUN_TEST_SECTION_IF_ENABLED(
       ENABLE_ERROR_HANDLING_TESTS, "ERROR HANDLING TESTS",
       RUN_TEST_IN_TASK("test_error_handling", test_error_handling, 8192, 5););
@@ -19,6 +19,9 @@
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
 #include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
@@ -83,6 +86,7 @@ public:
   void transfer(const uint8_t *tx, uint8_t *rx, std::size_t len) {
     if (!initialized_ || spi_device_ == nullptr) {
       ESP_LOGE(TAG, "SPI bus not initialized");
+      markFailed(rx, len);
       return;
     }
 
@@ -94,6 +98,7 @@ public:
     esp_err_t ret = spi_device_transmit(spi_device_, &trans);
     if (ret != ESP_OK) {
       ESP_LOGE(TAG, "SPI transfer failed: %s", esp_err_to_name(ret));
+      markFailed(rx, len);
     }
 
 #if ESP32_AS5047U_ENABLE_DETAILED_SPI_LOGGING
@@ -118,6 +123,118 @@ public:
 #endif
   }
 
+  /**
+   * @brief Transfer a list of frames, toggling CS between frames (optional hook)
+   *
+   * Queues the frames as separate ESP-IDF transactions (each one a CS cycle)
+   * so the driver's command/NOP sequences go out back-to-back without a
+   * blocking round trip per frame. Up to `queue_size` transactions are in
+   * flight at once.
+   *
+   * @param tx Contiguous transmit frames (frame_len * frame_count bytes).
+   * @param rx Contiguous receive frames, or nullptr to ignore received data.
+   * @param frame_len Bytes per frame.
+   * @param frame_count Number of frames.
+   */
+  void transfer_frames(const uint8_t *tx, uint8_t *rx, std::size_t frame_len,
+                       std::size_t frame_count) {
+    if (!initialized_ || spi_device_ == nullptr) {
+      ESP_LOGE(TAG, "SPI bus not initialized");
+      markFailed(rx, frame_len * frame_count);
+      return;
+    }
+
+    constexpr std::size_t kMaxInFlight = 8;
+    spi_transaction_t trans[kMaxInFlight];
+    const std::size_t window =
+        std::min<std::size_t>(kMaxInFlight, config_.queue_size > 0 ? config_.queue_size : 1);
+
+    std::size_t done = 0;
+    while (done < frame_count) {
+      const std::size_t batch = std::min(window, frame_count - done);
+      std::size_t queued = 0;
+      for (; queued < batch; ++queued) {
+        trans[queued] = {};
+        trans[queued].length = frame_len * 8;
+        trans[queued].tx_buffer = tx + ((done + queued) * frame_len);
+        trans[queued].rx_buffer = (rx != nullptr) ? rx + ((done + queued) * frame_len) : nullptr;
+        esp_err_t ret = spi_device_queue_trans(spi_device_, &trans[queued], portMAX_DELAY);
+        if (ret != ESP_OK) {
+          ESP_LOGE(TAG, "SPI queue failed: %s", esp_err_to_name(ret));
+          break;
+        }
+      }
+      for (std::size_t i = 0; i < queued; ++i) {
+        spi_transaction_t *result = nullptr;
+        spi_device_get_trans_result(spi_device_, &result, portMAX_DELAY);
+      }
+      if (queued < batch) {
+        const std::size_t sent = done + queued;
+        markFailed(rx != nullptr ? rx + (sent * frame_len) : nullptr,
+                   (frame_count - sent) * frame_len);
+        return;
+      }
+      done += batch;
+    }
+  }
+
+  /**
+   * @brief Start a frame-list transfer without waiting for it (optional async hook)
+   *
+   * Queues every frame as its own ESP-IDF transaction and returns. The SPI
+   * peripheral clocks them via DMA while the caller keeps running; completion
+   * is collected by is_done().
+   *
+   * @return false if the bus is busy, not initialized, or the frames do not
+   * fit into the transaction queue.
+   */
+  bool begin_transfer(const uint8_t *tx, uint8_t *rx, std::size_t frame_len,
+                      std::size_t frame_count) {
+    if (!initialized_ || spi_device_ == nullptr || async_pending_ != 0 ||
+        frame_count > kMaxAsyncFrames || frame_count > config_.queue_size) {
+      return false;
+    }
+    for (std::size_t i = 0; i < frame_count; ++i) {
+      async_trans_[i] = {};
+      async_trans_[i].length = frame_len * 8;
+      async_trans_[i].tx_buffer = tx + (i * frame_len);
+      async_trans_[i].rx_buffer = (rx != nullptr) ? rx + (i * frame_len) : nullptr;
+      esp_err_t ret = spi_device_queue_trans(spi_device_, &async_trans_[i], 0);
+      if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "SPI queue failed: %s", esp_err_to_name(ret));
+        // Never leave part of a list in flight: the driver does not track a refused transfer,
+        // so wait for the frames already queued before reporting the failure.
+        for (; async_pending_ > 0; --async_pending_) {
+          spi_transaction_t *result = nullptr;
+          spi_device_get_trans_result(spi_device_, &result, portMAX_DELAY);
+        }
+        return false;
+      }
+      ++async_pending_;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Collect finished transactions without blocking (optional async hook)
+   * @return true once every frame queued by begin_transfer() has completed.
+   */
+  bool is_done() {
+    while (async_pending_ > 0) {
+      spi_transaction_t *result = nullptr;
+      if (spi_device_get_trans_result(spi_device_, &result, 0) != ESP_OK) {
+        return false;
+      }
+      --async_pending_;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Let other tasks run while the driver waits for an async transfer (optional hook)
+   */
+  void wait_yield() { taskYIELD(); }
+
   /**
    * @brief Initialize the SPI bus (must be called before use)
    * @return true if successful, false otherwise
@@ -176,11 +293,28 @@ public:
   bool isInitialized() const noexcept { return initialized_; }
 
 private:
+  /**
+   * @brief Fill the receive bytes of frames that never went out with 0xFF.
+   *
+   * The driver's buffers are not initialized. All-ones frames have both status
+   * bits set, and in the CRC formats the CRC check fails, so the driver flags
+   * the read instead of decoding stale stack contents.
+   */
+  static void markFailed(uint8_t *rx, std::size_t bytes) {
+    if (rx != nullptr) {
+      std::memset(rx, 0xFF, bytes);
+    }
+  }
+
   SPIConfig config_;                         ///< SPI configuration
   spi_device_handle_t spi_device_ = nullptr; ///< SPI device handle
   bool initialized_ = false;                 ///< Initialization state
   static constexpr const char *TAG = "Esp32As5047uSpiBus"; ///< Logging tag
 
+  static constexpr std::size_t kMaxAsyncFrames = 4;        ///< frames per begin_transfer()
+  spi_transaction_t async_trans_[kMaxAsyncFrames] = {};    ///< in-flight async transactions
+  std::size_t async_pending_ = 0;                          ///< async transactions not yet collected
+
   /**
    * @brief Initialize SPI bus
    * @return true if successful, false otherwise
@@ -84,7 +84,7 @@ struct ControlPins {
 struct SPIParams {
     static constexpr uint32_t FREQUENCY = 1000000;    ///< 4MHz SPI frequency (conservative default)
     static constexpr uint8_t MODE = 1;                ///< SPI Mode 1 (CPOL=0, CPHA=1)
-    static constexpr uint8_t QUEUE_SIZE = 1;          ///< Transaction queue size
+    static constexpr uint8_t QUEUE_SIZE = 4;          ///< Transaction queue size (frames in flight for transfer_frames)
     static constexpr uint8_t CS_ENA_PRETRANS = 1;     ///< CS asserted N clock cycles before transaction
     static constexpr uint8_t CS_ENA_POSTTRANS = 1;   ///< CS held N clock cycles after transaction
     /// SPI host: 2 = SPI2_HOST, 3 = SPI3_HOST. Try 3 if SCLK does not toggle on your board.
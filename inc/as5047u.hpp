@@ -4,6 +4,11 @@
  * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
  */
 #pragma once
+#include "as5047u_clock.hpp"
+#include "as5047u_concurrency.hpp"
+#include "as5047u_crc.hpp"
+#include "as5047u_frames.hpp"
+#include "as5047u_log.hpp"
 #include "as5047u_spi_interface.hpp"
 #include "as5047u_registers.hpp"
 #include "as5047u_version.h"
@@ -12,24 +17,31 @@
 #include <atomic>
 #include <bitset>
 #include <cmath> // for M_PI and math functions
+#include <cstddef>
 #include <cstdint>
-#include <cstdio>     // for printf
+#include <cstdio>     // for printf (DumpStatus)
 #include <functional> // for std::function
-#include <utility>    // for std::pair
+#include <span>
+#include <tuple>      // for std::tuple
+#include <type_traits>
+#include <utility>    // for std::pair, std::index_sequence
 
 // Error flags from ERRFL register
 enum class AS5047U_Error : uint16_t {
   None = 0,
-  AgcWarning = 1 << 0,     ///< AGC reached minimum (0) or maximum (255) value
-  MagHalf = 1 << 1,        ///< Magnetic field is half of regulated value (AGC=255)
-  P2ramWarning = 1 << 2,   ///< ECC corrected 1 bit in P2RAM customer area
-  P2ramError = 1 << 3,     ///< ECC detected 2+ uncorrectable errors in P2RAM
-  FramingError = 1 << 4,   ///< SPI framing error
-  CommandError = 1 << 5,   ///< Invalid SPI command received
-  CrcError = 1 << 6,       ///< CRC error during SPI communication
-  WatchdogError = 1 << 7,  ///< Internal oscillator or watchdog not working proper
-  OffCompError = 1 << 9,   ///< Internal offset compensation not finished
-  CordicOverflow = 1 << 10 ///< CORDIC algorithm overflow
+  AgcWarning = 1 << 0,         ///< AGC reached minimum (0) or maximum (255) value
+  MagHalf = 1 << 1,            ///< Magnetic field is half of regulated value (AGC=255)
+  P2ramWarning = 1 << 2,       ///< ECC corrected 1 bit in P2RAM customer area
+  P2ramError = 1 << 3,         ///< ECC detected 2+ uncorrectable errors in P2RAM
+  FramingError = 1 << 4,       ///< SPI framing error
+  CommandError = 1 << 5,       ///< Invalid SPI command received
+  CrcError = 1 << 6,           ///< CRC error during SPI communication
+  WatchdogError = 1 << 7,      ///< Internal oscillator or watchdog not working proper
+  OffCompError = 1 << 9,       ///< Internal offset compensation not finished
+  CordicOverflow = 1 << 10,    ///< CORDIC algorithm overflow
+  ResponseCrcError = 1 << 11,  ///< Host-side CRC mismatch on a received MISO frame (not in ERRFL)
+  WriteVerifyFailed = 1 << 12, ///< A write did not read back its value (immediate or deferred)
+  BusBusy = 1 << 13            ///< Host-side: no read ran, another asynchronous transfer owned the bus
 };
 
 // -----------------------------------------------------------------------------
@@ -62,6 +74,68 @@ enum class VelocityUnit : uint8_t {
   Rpm
 };
 
+/// Errors that make a read unusable: a communication fault seen by the device or by the host.
+inline constexpr uint16_t COMM_ERROR_MASK = static_cast<uint16_t>(AS5047U_Error::CrcError) |
+                                            static_cast<uint16_t>(AS5047U_Error::FramingError) |
+                                            static_cast<uint16_t>(AS5047U_Error::ResponseCrcError) |
+                                            static_cast<uint16_t>(AS5047U_Error::BusBusy);
+
+/**
+ * @brief A value read from the sensor together with the errors seen while reading it.
+ *
+ * Returned by the *Result() getters. `errors` covers only the frames of the
+ * returned read (host-side CRC, in-frame status and the ERRFL fetched for it).
+ * The same bits are also merged into the sticky flags, but nothing is cleared,
+ * so GetStickyErrorFlags() still sees them.
+ */
+template <typename T>
+struct Result {
+  T value{};                                ///< decoded value (last attempt)
+  AS5047U_Error errors{AS5047U_Error::None}; ///< errors of that attempt
+
+  /// true if no communication error hit the read (warnings such as AgcWarning may be set).
+  [[nodiscard]] constexpr bool Ok() const noexcept {
+    return (static_cast<uint16_t>(errors) & COMM_ERROR_MASK) == 0U;
+  }
+  /// true if every bit of flag is set in errors.
+  [[nodiscard]] constexpr bool Has(AS5047U_Error flag) const noexcept {
+    return (static_cast<uint16_t>(errors) & static_cast<uint16_t>(flag)) ==
+           static_cast<uint16_t>(flag);
+  }
+};
+
+/**
+ * @brief A Result stamped with the time its value was latched by the sensor.
+ *
+ * Returned by the *Timed() getters. `timestamp` is in ticks of the driver's
+ * clock policy and marks the command frame of the returned read (see
+ * as5047u_clock.hpp); it is 0 with NullClock.
+ */
+template <typename T>
+struct TimedResult : Result<T> {
+  uint64_t timestamp{0}; ///< clock-policy ticks at the command frame
+};
+
+/**
+ * @brief One acquisition of the motion registers, as returned by AS5047U::ReadSample().
+ *
+ * Trivially copyable and 16 bytes, so it can be published through a
+ * SampleSnapshot (as5047u_snapshot.hpp) or queued by value.
+ */
+struct EncoderSample {
+  uint64_t timestamp{0};                     ///< clock-policy ticks when the angle was latched
+  uint16_t angle{0};                         ///< ANGLECOM (DAEC-compensated), 0-16383
+  uint16_t raw_angle{0};                     ///< ANGLEUNC (uncompensated), 0-16383
+  int16_t velocity{0};                       ///< VEL, signed 14-bit LSB
+  AS5047U_Error errors{AS5047U_Error::None}; ///< errors of this acquisition
+};
+
+/// One element of an interleaved angle + velocity burst (AS5047U::ReadAnglesVelocities()).
+struct AngleVelocity {
+  uint16_t angle{0};   ///< ANGLECOM, 0-16383
+  int16_t velocity{0}; ///< VEL, signed 14-bit LSB
+};
+
 /**
  * @brief AS5047U magnetic rotary sensor driver class.
  *
@@ -71,17 +145,65 @@ enum class VelocityUnit : uint8_t {
  * performing OTP programming for permanent configuration storage.
  *
  * @tparam SpiType The SPI bus type (must inherit from as5047u::SpiInterface<SpiType>)
+ * @tparam Format  RuntimeFrameFormat{} (default) to select the frame format at run time
+ *                 with SetFrameFormat(), or a FrameFormat value to fix it at compile time.
+ *                 A fixed-format driver has no format branches left after inlining, so only
+ *                 the needed frame codec ends up in flash (SPI_16 still links the 24-bit
+ *                 encoder for writes, which always use CRC frames).
+ * @tparam LogPolicy Receives driver diagnostics as LogRecord values (see
+ *                 as5047u_log.hpp). NullLog (default) discards them, PrintfLog
+ *                 prints them, RingBufferLog queues them for another task.
+ * @tparam Concurrency Storage of the sticky flags and bus locking (see
+ *                 as5047u_concurrency.hpp). SharedFlags (default) keeps atomic
+ *                 flags and no lock; SingleThreaded drops the atomics;
+ *                 Locked<Mutex> / SpinLocked hold a lock across each multi-frame
+ *                 sequence so several threads can share the driver.
+ * @tparam ClockPolicy Time base of sample timestamps (see as5047u_clock.hpp).
+ *                 NullClock (default) disables timestamping; SteadyClock,
+ *                 CycleCounterClock<> or CallbackClock<fn> stamp each read with
+ *                 the time of its command frame.
+ *
+ * @code
+ * AS5047U encoder(bus, FrameFormat::SPI_24);           // runtime-switchable
+ * AS5047U<MyBus, FrameFormat::SPI_24> fixed(bus);      // 24-bit frames only
+ * AS5047U<MyBus, RuntimeFrameFormat{}, RingBufferLog<>> logged(bus);
+ * AS5047U<MyBus, FrameFormat::SPI_24, NullLog, Locked<std::mutex>> shared(bus);
+ * AS5047U<MyBus, FrameFormat::SPI_24, NullLog, SharedFlags, SteadyClock> timed(bus);
+ * @endcode
  *
  * @note The driver uses CRTP-based SPI interface for zero virtual call
  * overhead. SPI implementations should inherit from
  * as5047u::SpiInterface<DerivedType>
  *
- * @note C++17 CTAD allows automatic type deduction:
+ * @note C++17 CTAD allows automatic type deduction (runtime-format drivers):
  *       AS5047U encoder(bus, format); // Type deduced automatically
  */
-template <typename SpiType>
+template <typename SpiType, auto Format = RuntimeFrameFormat{}, typename LogPolicy = NullLog,
+          typename Concurrency = SharedFlags, typename ClockPolicy = NullClock>
 class AS5047U {
+  static_assert(std::is_same_v<std::remove_cv_t<decltype(Format)>, RuntimeFrameFormat> ||
+                    std::is_same_v<std::remove_cv_t<decltype(Format)>, FrameFormat>,
+                "AS5047U format argument must be RuntimeFrameFormat{} or a FrameFormat value");
+  static_assert(DriverLog<LogPolicy>, "AS5047U log policy needs a static Log(const LogRecord&)");
+  static_assert(ConcurrencyPolicy<Concurrency>,
+                "AS5047U concurrency policy needs Flags, Mutex and LOCKS_BUS");
+  static_assert(TimestampClock<ClockPolicy>,
+                "AS5047U clock policy needs static Now(), TICKS_PER_SECOND and ENABLED");
+
 public:
+  /// Clock policy used for sample timestamps.
+  using Clock = ClockPolicy;
+  /// True when the frame format is a template argument rather than a runtime member.
+  static constexpr bool FIXED_FRAME_FORMAT =
+      std::is_same_v<std::remove_cv_t<decltype(Format)>, FrameFormat>;
+  /// True when the asynchronous API is available: an async bus and a policy without a bus lock.
+  static constexpr bool ASYNC_TRANSFERS = SupportsAsyncTransfer<SpiType> && !Concurrency::LOCKS_BUS;
+#if AS5047U_HAS_COROUTINES
+  /// True when the coroutine awaitables are available (same rule as ASYNC_TRANSFERS).
+  static constexpr bool COROUTINE_TRANSFERS =
+      SupportsCoroutineResume<SpiType> && !Concurrency::LOCKS_BUS;
+#endif
+
   //------------------------------------------------------------------
   // Constructor and destructor
   //------------------------------------------------------------------
@@ -92,18 +214,21 @@ public:
    * @param format SPI frame format to use (16-bit, 24-bit, or 32-bit). Default
    * is 16-bit frames.
    */
-  explicit AS5047U(SpiType& bus, FrameFormat format = AS5047U_CFG::DEFAULT_FRAME_FORMAT) noexcept;
+  explicit AS5047U(SpiType& bus, FrameFormat format = AS5047U_CFG::DEFAULT_FRAME_FORMAT) noexcept
+    requires(!FIXED_FRAME_FORMAT);
+
+  /**
+   * @brief Construct a driver whose frame format is fixed by the template argument.
+   * @param bus Reference to an SPI interface implementation.
+   */
+  explicit AS5047U(SpiType& bus) noexcept
+    requires(FIXED_FRAME_FORMAT);
 
   ~AS5047U() = default;
 
-  /** Compute the CRC8 value used by AS5047U SPI frames. */
+  /** Compute the CRC8 value used by AS5047U SPI frames (table-driven, see as5047u_crc.hpp). */
   static constexpr uint8_t ComputeCRC8(uint16_t data16) {
-    uint8_t crc = 0xC4;
-    for (int i = 0; i < 16; ++i) {
-      bool bit = ((data16 >> (15 - i)) & 1) ^ ((crc >> 7) & 1);
-      crc = (crc << 1) ^ (bit ? 0x1D : 0x00);
-    }
-    return crc ^ 0xFF;
+    return Crc8(data16);
   }
 
   //------------------------------------------------------------------
@@ -113,13 +238,59 @@ public:
    * @brief Set the SPI frame format (16, 24, or 32-bit).
    * @param format The desired SPI frame format.
    */
-  void SetFrameFormat(FrameFormat format) noexcept;
+  void SetFrameFormat(FrameFormat format) noexcept
+    requires(!FIXED_FRAME_FORMAT);
+
+  /**
+   * @brief Select how sticky error flags are refreshed after each read.
+   *
+   * ErrorCheckMode::ReadErrfl (default) reads ERRFL after every register read.
+   * ErrorCheckMode::InFrame decodes the status bits carried in the MISO data
+   * frame and reads ERRFL only when one of them is set.
+   * @param mode The desired error-check mode.
+   */
+  void SetErrorCheckMode(ErrorCheckMode mode) noexcept;
+
+  /** @brief Get the currently selected error-check mode. */
+  [[nodiscard]] ErrorCheckMode GetErrorCheckMode() const noexcept;
+
+  /**
+   * @brief Select how register writes are verified (default: AS5047U_CFG::DEFAULT_WRITE_VERIFY).
+   *
+   * Applies to WriteReg(), WriteRegs(), the configuration setters and
+   * ConfigTransaction. WriteVerify::Immediate checks every write with the
+   * following frame; WriteVerify::Deferred sends command + data only and queues
+   * the write for VerifyPendingWrites(); WriteVerify::None never reads back.
+   * Failed verifications set AS5047U_Error::WriteVerifyFailed. Asynchronous and
+   * coroutine writes, and ProgramOTP(), always verify immediately.
+   * @param verify The desired verify policy.
+   */
+  void SetWriteVerify(WriteVerify verify) noexcept;
+
+  /** @brief Get the current write-verify policy. */
+  [[nodiscard]] WriteVerify GetWriteVerify() const noexcept;
+
+  /**
+   * @brief Check all writes queued under WriteVerify::Deferred in one chained read.
+   *
+   * Costs N+1 frames (N+2 in ErrorCheckMode::ReadErrfl) for N queued registers;
+   * a register written several times is checked once, against its last value.
+   * The queue also flushes itself when full (DEFERRED_VERIFY_CAPACITY registers).
+   * @return true if every queued register holds the value written.
+   */
+  bool VerifyPendingWrites();
+
+  /** @brief Number of registers waiting for VerifyPendingWrites(). */
+  [[nodiscard]] std::size_t GetPendingWriteCount() const noexcept;
+
+  /// Registers the deferred-verify queue holds before it verifies itself.
+  static constexpr std::size_t DEFERRED_VERIFY_CAPACITY = 8;
 
   /**
    * @brief Read the 14-bit absolute angle with dynamic compensation (DAEC
    * active).
    *  @param retries Number of retries on CRC/framing error (default 0 = no
-   * retry).
+   * retry). A CRC mismatch detected on the received frame also triggers a retry.
    *  @return The current angle in LSB (0-16383).
    */
   [[nodiscard]] uint16_t GetAngle(uint8_t retries = AS5047U_CFG::CRC_RETRIES) const;
@@ -153,6 +324,18 @@ public:
    */
   [[nodiscard]] uint16_t GetRawAngle(uint8_t retries = AS5047U_CFG::CRC_RETRIES) const;
 
+  /**
+   * @brief Read the compensated angle using the pipelined continuous-read mode.
+   *
+   * Each call sends the ANGLECOM read command for the next sample in the same
+   * frame that returns the previous one, so steady-state reads cost a single
+   * SPI frame. The returned value is the angle latched at the previous call;
+   * the first call (or the first call after any other register access) sends
+   * one extra priming frame.
+   * @return The angle in LSB (0-16383) requested by the previous call.
+   */
+  [[nodiscard]] uint16_t GetAngleContinuous() const;
+
   /**
    * @brief Read the current rotational velocity (signed 14-bit).
    *  @param retries Number of retries on CRC/framing error (default 0 = no
@@ -222,6 +405,79 @@ public:
    */
   [[nodiscard]] uint16_t GetMagnitude(uint8_t retries = AS5047U_CFG::CRC_RETRIES) const;
 
+  /**
+   * @name Error-returning getters
+   * Same reads as GetAngle(), GetRawAngle(), GetVelocity(), GetAGC() and
+   * GetMagnitude(), but the errors of the returned read come back with the
+   * value instead of being fetched (and cleared) from the sticky flags. A retry
+   * is made while Result::Ok() is false; `errors` belongs to the last attempt.
+   * @param retries Number of retries on a communication error (default 0 = no retry).
+   * @{
+   */
+  [[nodiscard]] Result<uint16_t> GetAngleResult(uint8_t retries = AS5047U_CFG::CRC_RETRIES) const;
+  [[nodiscard]] Result<uint16_t> GetRawAngleResult(uint8_t retries = AS5047U_CFG::CRC_RETRIES) const;
+  [[nodiscard]] Result<int16_t> GetVelocityResult(uint8_t retries = AS5047U_CFG::CRC_RETRIES) const;
+  [[nodiscard]] Result<uint8_t> GetAGCResult(uint8_t retries = AS5047U_CFG::CRC_RETRIES) const;
+  [[nodiscard]] Result<uint16_t> GetMagnitudeResult(uint8_t retries = AS5047U_CFG::CRC_RETRIES) const;
+  /** @} */
+
+  /**
+   * @name Timestamped getters
+   * GetAngleResult(), GetVelocityResult() and GetAngleContinuous() with the time
+   * the returned value was latched, in ticks of the clock policy. The sensor
+   * latches a value at its read command frame, so that is the instant reported:
+   * the frame before the response for a plain read, and the previous call's
+   * frame for a pipelined read. With NullClock the timestamp is 0.
+   * @param retries Number of retries on a communication error (default 0 = no retry).
+   * @{
+   */
+  [[nodiscard]] TimedResult<uint16_t> GetAngleTimed(uint8_t retries = AS5047U_CFG::CRC_RETRIES) const;
+  [[nodiscard]] TimedResult<int16_t> GetVelocityTimed(uint8_t retries = AS5047U_CFG::CRC_RETRIES) const;
+  [[nodiscard]] TimedResult<uint16_t> GetAngleContinuousTimed() const;
+  /** @} */
+
+  /**
+   * @brief Read compensated angle, raw angle and velocity in one chained transaction.
+   *
+   * Costs 4 frames in ErrorCheckMode::InFrame (5 in ReadErrfl mode) instead of
+   * three separate reads. The errors of the chain are returned in the sample and
+   * merged into the sticky flags. Used to feed a SampleSnapshot.
+   * The sample is stamped with the clock policy at the ANGLECOM command frame
+   * (0 with NullClock).
+   */
+  [[nodiscard]] EncoderSample ReadSample() const;
+
+  /**
+   * @brief Burst capture: fill `angles` with back-to-back ANGLECOM samples.
+   *
+   * Uses the next-frame response: every frame carries the read command for the
+   * next sample and returns the previous one, so N samples cost N+1 frames. The
+   * command frames are assembled once and sent as frame lists of up to
+   * BURST_CHUNK_FRAMES frames (one transfer_frames() call each when the bus
+   * provides it). Status bits are checked in-frame. ERRFL is read at most once,
+   * at the end, and all errors are merged into the sticky flags with a single
+   * atomic OR.
+   *
+   * @param angles       Receives the samples (0-16383), oldest first.
+   * @param error_bitmap Optional; bit i (byte i / 8, bit i % 8) is set when sample i
+   *                     had a CRC mismatch or an error/warning status bit. Bits past
+   *                     the end of the span are not recorded.
+   * @return Number of samples flagged in error (0 for a clean burst).
+   */
+  std::size_t ReadAngles(std::span<uint16_t> angles, std::span<uint8_t> error_bitmap = {}) const;
+
+  /**
+   * @brief Burst capture of interleaved ANGLECOM / VEL pairs (see ReadAngles()).
+   *
+   * Frames alternate angle and velocity commands, so N pairs cost 2N+1 frames.
+   * Bit i of `error_bitmap` covers both reads of pair i.
+   */
+  std::size_t ReadAnglesVelocities(std::span<AngleVelocity> samples,
+                                   std::span<uint8_t> error_bitmap = {}) const;
+
+  /// Frames per frame-list transfer in the burst APIs (sizes the stack buffers).
+  static constexpr std::size_t BURST_CHUNK_FRAMES = 64;
+
   /**
    * @brief Read and clear error flags.
    * @param retries Number of retries on CRC/framing error (default 0 = no
@@ -426,13 +682,228 @@ public:
    * sensor
    *
    * This method reads the raw value from the specified register address and
-   * decodes it into a strongly-typed register object.
+   * decodes it into a strongly-typed register object. It always reads the
+   * device; for a cached configuration register the result also refreshes the
+   * configuration cache.
    */
   template <typename RegT>
   RegT ReadReg() const {
     return decode<RegT>(readRegister(RegT::ADDRESS));
   }
 
+  /**
+   * @brief Read a register and return it with the errors of this read
+   *
+   * Same transaction as ReadReg(); the errors are merged into the sticky flags
+   * with a single atomic OR (none when the read was clean) and returned.
+   */
+  template <typename RegT>
+  Result<RegT> ReadRegResult() const {
+    uint16_t errors = 0;
+    const uint16_t raw = readRegister(RegT::ADDRESS, errors);
+    mergeStickyErrors(errors);
+    return {decode<RegT>(raw), static_cast<AS5047U_Error>(errors)};
+  }
+
+  /**
+   * @brief Read several registers in one chained transaction
+   *
+   * @tparam RegTs The register types to read (each must have an ADDRESS static
+   * member and be decodable)
+   * @return std::tuple<RegTs...> The decoded registers, in template order
+   *
+   * Each read command is sent in the frame that returns the response to the
+   * previous one, so N registers cost N+1 frames in ErrorCheckMode::InFrame
+   * (ERRFL is then only read if a status bit was set), or N+2 frames in
+   * ErrorCheckMode::ReadErrfl (a single ERRFL read closes the chain).
+   *
+   * @code
+   * auto [ang, vel, mag, agc] = encoder.ReadRegs<AS5047U_REG::ANGLECOM, AS5047U_REG::VEL,
+   *                                              AS5047U_REG::MAG, AS5047U_REG::AGC>();
+   * @endcode
+   */
+  template <typename... RegTs>
+  std::tuple<RegTs...> ReadRegs() const {
+    static_assert(sizeof...(RegTs) > 0, "ReadRegs needs at least one register");
+    constexpr std::array<uint16_t, sizeof...(RegTs)> addresses{RegTs::ADDRESS...};
+    std::array<uint16_t, sizeof...(RegTs)> raw{};
+    // Chain = N commands + closing NOP/ERRFL command + optional ERRFL NOP
+    std::array<uint8_t, (sizeof...(RegTs) + 2U) * MAX_FRAME_BYTES> tx{};
+    std::array<uint8_t, (sizeof...(RegTs) + 2U) * MAX_FRAME_BYTES> rx{};
+    readRegisterChain(addresses.data(), raw.data(), sizeof...(RegTs), tx.data(), rx.data());
+    return decodeChain<RegTs...>(raw.data(), std::index_sequence_for<RegTs...>{});
+  }
+
+  //------------------------------------------------------------------
+  // Asynchronous reads (bus must satisfy SupportsAsyncTransfer; not with a locking policy)
+  //------------------------------------------------------------------
+
+  /**
+   * @brief Start a non-blocking read of a register.
+   *
+   * Queues the whole read sequence (command, NOP, plus the ERRFL command in
+   * ErrorCheckMode::ReadErrfl) as one frame list through the bus's
+   * begin_transfer() hook and returns immediately. Poll IsAsyncReadDone() and
+   * fetch the value with CompleteAsyncRead<RegT>(). No other driver call may
+   * use the bus while the read is in flight.
+   *
+   * @tparam RegT Register to read (must have an ADDRESS static member).
+   * @return false if a read is already in flight or the bus refused the transfer.
+   */
+  template <typename RegT>
+  bool StartAsyncRead()
+    requires ASYNC_TRANSFERS
+  {
+    return startAsyncRead(RegT::ADDRESS);
+  }
+
+  /** @brief Start a non-blocking ANGLECOM read (see StartAsyncRead()). */
+  bool StartAsyncAngleRead()
+    requires ASYNC_TRANSFERS
+  {
+    return startAsyncRead(AS5047U_REG::ANGLECOM::ADDRESS);
+  }
+
+  /** @brief Start a non-blocking VEL read (see StartAsyncRead()). */
+  bool StartAsyncVelocityRead()
+    requires ASYNC_TRANSFERS
+  {
+    return startAsyncRead(AS5047U_REG::VEL::ADDRESS);
+  }
+
+  /**
+   * @brief Start a non-blocking pipelined read (asynchronous ReadRegContinuous()).
+   *
+   * Sends one read command frame for RegT (two if the in-flight response
+   * belongs to another address) and returns immediately. CompleteAsyncRead<RegT>()
+   * then returns the response to the previous RegT command. Status bits are
+   * always checked in-frame, as in ReadRegContinuous().
+   *
+   * @tparam RegT Register to read (must have an ADDRESS static member).
+   * @return false if a transfer is already in flight or the bus refused it.
+   */
+  template <typename RegT>
+  bool StartAsyncReadContinuous()
+    requires ASYNC_TRANSFERS
+  {
+    return startAsyncContinuousRead(RegT::ADDRESS);
+  }
+
+  /**
+   * @brief Poll whether the in-flight asynchronous read has finished clocking.
+   * @return true when the frames are done (or no read is in flight).
+   */
+  [[nodiscard]] bool IsAsyncReadDone()
+    requires ASYNC_TRANSFERS;
+
+  /**
+   * @brief Decode the result of the asynchronous read started last.
+   *
+   * Waits for completion if the frames are still in flight, then decodes the
+   * response and updates the sticky error flags. The wait polls is_done() in a
+   * loop: a busy-wait unless the bus provides wait_yield() (SupportsWaitYield),
+   * which is called between polls. In ErrorCheckMode::InFrame an
+   * ERRFL read is performed synchronously here if the data frame reported an
+   * error.
+   *
+   * @tparam RegT Register type passed to StartAsyncRead().
+   * @return The decoded register (value 0 if no read was started).
+   */
+  template <typename RegT>
+  RegT CompleteAsyncRead()
+    requires ASYNC_TRANSFERS
+  {
+    return decode<RegT>(completeAsyncRead());
+  }
+
+  /** @brief Complete an angle read started with StartAsyncAngleRead(). */
+  [[nodiscard]] uint16_t CompleteAsyncAngle()
+    requires ASYNC_TRANSFERS
+  {
+    return CompleteAsyncRead<AS5047U_REG::ANGLECOM>().bits.ANGLECOM_value;
+  }
+
+  /** @brief Complete a velocity read started with StartAsyncVelocityRead(). */
+  [[nodiscard]] int16_t CompleteAsyncVelocity()
+    requires ASYNC_TRANSFERS
+  {
+    const uint16_t v = CompleteAsyncRead<AS5047U_REG::VEL>().bits.VEL_value;
+    return static_cast<int16_t>(static_cast<int16_t>(v << 2) >> 2);
+  }
+
+#if AS5047U_HAS_COROUTINES
+  //------------------------------------------------------------------
+  // Coroutine awaitables (bus must satisfy SupportsCoroutineResume; not with a locking policy)
+  //------------------------------------------------------------------
+  template <typename RegT>
+  class ReadAwaitable;
+  template <typename RegT>
+  class WriteAwaitable;
+  class AngleAwaitable;
+  class VelocityAwaitable;
+
+  /**
+   * @brief co_await-able register read.
+   *
+   * Suspends the calling coroutine while the frames are on the bus; the bus's
+   * resume_when_done() executor resumes it on completion and the awaitable
+   * yields the decoded register with the errors of the read, like
+   * ReadRegResult(). One awaitable per driver may be in flight at a time; if
+   * the bus refuses the transfer the read falls back to blocking. If another
+   * asynchronous transfer owns the bus, no read runs: the result carries
+   * AS5047U_Error::BusBusy (also set in the sticky flags) and Ok() is false.
+   * @code
+   * auto s2 = co_await encoder.AwaitReadReg<AS5047U_REG::SETTINGS2>();
+   * if (s2.Ok()) { use(s2.value); }
+   * @endcode
+   */
+  template <typename RegT>
+  ReadAwaitable<RegT> AwaitReadReg()
+    requires COROUTINE_TRANSFERS
+  {
+    return ReadAwaitable<RegT>(*this);
+  }
+
+  /**
+   * @brief co_await-able register write; yields true if the NOP read-back
+   * matched. Mismatches update the sticky error flags from ERRFL; a write that
+   * could not run because the bus was busy yields false and sets BusBusy.
+   */
+  template <typename RegT>
+  WriteAwaitable<RegT> AwaitWriteReg(const RegT& reg)
+    requires COROUTINE_TRANSFERS
+  {
+    return WriteAwaitable<RegT>(*this, reg);
+  }
+
+  /** @brief co_await-able GetAngleResult(); yields the angle in LSB (0-16383) and its errors. */
+  AngleAwaitable AwaitAngle()
+    requires COROUTINE_TRANSFERS;
+
+  /** @brief co_await-able GetVelocityResult(); yields the signed velocity in LSB and its errors. */
+  VelocityAwaitable AwaitVelocity()
+    requires COROUTINE_TRANSFERS;
+#endif
+
+  /**
+   * @brief Read a register using the pipelined continuous-read mode
+   *
+   * @tparam RegT The register type which must have an ADDRESS static member and
+   * be decodable
+   * @return RegT The register content requested by the previous call
+   *
+   * The AS5047U returns read data on the *next* frame. Instead of following
+   * every read command with a NOP, this sends the read command for RegT again
+   * and returns the response to the previous one: one frame per call in steady
+   * state. If the in-flight response belongs to another address, a priming
+   * frame is sent first (two frames). Intended for fixed-rate loops that keep
+   * polling the same register.
+   */
+  template <typename RegT>
+  RegT ReadRegContinuous() const {
+    return decode<RegT>(continuousReadRegister(RegT::ADDRESS));
+  }
+
   /**
    * @brief Writes data to a specified register in the AS5047U sensor
    *
@@ -445,15 +916,122 @@ public:
    */
   template <typename RegT>
   bool WriteReg(const RegT& reg, uint8_t retries = AS5047U_CFG::CRC_RETRIES) {
-    return writeRegister(RegT::ADDRESS, encode(reg), retries);
+    return writeRegister(RegT::ADDRESS, encode(reg), retries, this->write_verify_);
   }
 
+  /**
+   * @brief Write a register with an explicit verify policy for this call
+   * @param reg The register object containing the data to be written
+   * @param verify Verify policy overriding SetWriteVerify() for this write
+   * @param retries Number of retries on a failed immediate verify
+   * @return true if the write was verified, or was sent without verification
+   *
+   * @code
+   * encoder.WriteReg(zposm, WriteVerify::None); // homing: command + data frames only
+   * @endcode
+   */
+  template <typename RegT>
+  bool WriteReg(const RegT& reg, WriteVerify verify, uint8_t retries = AS5047U_CFG::CRC_RETRIES) {
+    return writeRegister(RegT::ADDRESS, encode(reg), retries, verify);
+  }
+
+  /**
+   * @brief Write several registers in one chained transaction
+   *
+   * @tparam RegTs The register types to write (each must have an ADDRESS static
+   * member and be encodable)
+   * @param regs The register values, written in argument order
+   * @return true if every register read back its new value
+   *
+   * The frame after a write's data frame returns the register's new content,
+   * so write k is verified by the command frame of write k+1 and only the last
+   * write is followed by a NOP: N registers cost 2N+1 frames instead of 3N.
+   * On a mismatch ERRFL is read once for the whole chain and the chain is
+   * resent up to AS5047U_CFG::CRC_RETRIES times.
+   *
+   * @code
+   * encoder.WriteRegs(settings1, settings2, settings3); // 7 frames instead of 9
+   * @endcode
+   */
+  template <typename... RegTs>
+    requires(sizeof...(RegTs) > 0 && (requires { RegTs::ADDRESS; } && ...))
+  bool WriteRegs(const RegTs&... regs) {
+    return writeRegs(AS5047U_CFG::CRC_RETRIES, regs...);
+  }
+
+  /**
+   * @brief Write a run-time list of registers as chained transactions
+   *
+   * Same protocol as the typed WriteRegs(); the list is sent in chains of up
+   * to WRITE_CHAIN_LENGTH writes (2N+1 frames each), which suits bulk
+   * configuration or production programming tables.
+   * @param writes Address/value pairs, written in order.
+   * @param retries Resends of a chain whose read-back did not match.
+   * @return true if every register read back its new value
+   */
+  bool WriteRegs(std::span<const RegisterWrite> writes,
+                 uint8_t retries = AS5047U_CFG::CRC_RETRIES);
+
+  /// Longest chain sent by WriteRegs(std::span<const RegisterWrite>) in one frame list.
+  static constexpr std::size_t WRITE_CHAIN_LENGTH = 16;
+
   /**
    * @brief Retrieve and clear the accumulated sticky error flags.
    * @return Bitwise OR of AS5047U_Error enum flags since last call.
    */
   AS5047U_Error GetStickyErrorFlags() const;
 
+  //------------------------------------------------------------------
+  // Configuration cache (DISABLE, ZPOSM, ZPOSL, SETTINGS1-3)
+  //------------------------------------------------------------------
+
+  /**
+   * @brief Enable or disable the write-back cache of the volatile configuration registers.
+   *
+   * With the cache enabled, DISABLE, ZPOSM, ZPOSL and SETTINGS1-3 are read from
+   * the device once and then kept in RAM: field setters (SetDirection(),
+   * SetHysteresis(), ...) modify the cached copy and issue a single verified
+   * write, and getters such as GetHysteresis() or GetAngleOutputSource() cost no
+   * bus traffic. Entries are filled by error-free reads and verified writes and
+   * dropped when a write fails to verify. Disabling the cache also clears it.
+   * The compile-time default is AS5047U_CFG::ENABLE_CONFIG_CACHE.
+   */
+  void EnableConfigCache(bool enable) noexcept;
+
+  /** @brief Whether the configuration cache is enabled. */
+  [[nodiscard]] bool IsConfigCacheEnabled() const noexcept;
+
+  /**
+   * @brief Drop every cached configuration register.
+   *
+   * Call after anything that changes the registers behind the driver: an OTP
+   * refresh through a raw PROG write, a power cycle of the sensor, or another
+   * bus master. ProgramOTP() invalidates the cache itself.
+   */
+  void InvalidateConfigCache() noexcept;
+
+  /**
+   * @brief Reload all cached configuration registers in one chained read.
+   * @return true if the cache is enabled and the read completed without a
+   * CRC/framing error; otherwise the cache is left invalidated.
+   */
+  bool RefreshConfigCache();
+
+  //------------------------------------------------------------------
+  // Configuration transactions
+  //------------------------------------------------------------------
+  class ConfigTransaction;
+
+  /**
+   * @brief Start a batched configuration change.
+   *
+   * Field edits on the returned ConfigTransaction are collected locally and
+   * every changed register is written exactly once, in one chained transfer,
+   * when the transaction commits or goes out of scope.
+   * @param retries Retries for the register preload and for the chained write.
+   */
+  ConfigTransaction BeginConfig(uint8_t retries = AS5047U_CFG::CRC_RETRIES);
+
   // ===========================================================================
   // Driver Version
   // ===========================================================================
@@ -485,17 +1063,250 @@ private:
   //------------------------------------------------------------------
   // Low-level helpers
   //------------------------------------------------------------------
+  static constexpr std::size_t MAX_FRAME_BYTES = 4;     ///< largest frame (SPI_32)
+  static constexpr uint16_t NO_PENDING_READ = 0xFFFF;  ///< no known read response in flight
+  static constexpr uint16_t FRAME_STATUS_MASK = 0xC000; ///< ER/Error bits of a MISO data word
+  /// Sticky errors that make the retry loops of the getters re-read the register.
+  static constexpr uint16_t RETRY_ERROR_MASK = COMM_ERROR_MASK;
+  /// ERRFL bits 0-7, 9 and 10; AS5047U_Error uses the same bit positions for them.
+  static constexpr uint16_t ERRFL_ERROR_MASK = 0x06FF;
+  static_assert(static_cast<uint16_t>(AS5047U_Error::AgcWarning) == (1U << 0) &&
+                    static_cast<uint16_t>(AS5047U_Error::FramingError) == (1U << 4) &&
+                    static_cast<uint16_t>(AS5047U_Error::CrcError) == (1U << 6) &&
+                    static_cast<uint16_t>(AS5047U_Error::WatchdogError) == (1U << 7) &&
+                    static_cast<uint16_t>(AS5047U_Error::OffCompError) == (1U << 9) &&
+                    static_cast<uint16_t>(AS5047U_Error::CordicOverflow) == (1U << 10),
+                "ERRFL -> AS5047U_Error mapping relies on identical bit positions");
+  /// VEL register value (14-bit two's complement) -> signed LSB.
+  static constexpr int16_t velocityFromRaw(uint16_t vel) noexcept {
+    return static_cast<int16_t>(static_cast<int16_t>(vel << 2) >> 2);
+  }
+  /// ERRFL content -> AS5047U_Error bits (a mask: the layouts match).
+  static constexpr uint16_t errflToErrors(uint16_t err_fl) noexcept {
+    return static_cast<uint16_t>(err_fl & ERRFL_ERROR_MASK);
+  }
+
+  /// Frame length in bytes for a frame format (2, 3 or 4).
+  static constexpr std::size_t frameLength(FrameFormat format) noexcept {
+    return format == FrameFormat::SPI_16 ? 2U : format == FrameFormat::SPI_24 ? 3U : 4U;
+  }
+  /// Active frame format: the template argument for fixed-format drivers, else frame_format_.
+  FrameFormat frameFormat() const noexcept {
+    if constexpr (FIXED_FRAME_FORMAT) {
+      return Format;
+    } else {
+      return this->frame_format_;
+    }
+  }
+  /// Frame length in bytes for the current frame format.
+  std::size_t frameLength() const noexcept {
+    return frameLength(frameFormat());
+  }
+
+  // Frame codec helpers
+  void encodeFrame(FrameFormat format, uint16_t payload, uint8_t* tx) const noexcept;
+  void copyFrameImage(FrameFormat format, const FrameImage& image,
+                      uint8_t* tx) const noexcept; ///< ROM command image, pad patched for SPI_32
+  void encodeReadCommand(uint16_t addr, uint8_t* tx) const noexcept; ///< build a read command frame
+  void encodeWriteSequence(FrameFormat format, uint16_t addr, uint16_t val,
+                           uint8_t* tx) const noexcept; ///< cmd, data, NOP frames
+  uint16_t decodeFrame(FrameFormat format, const uint8_t* rx) const noexcept; ///< CRC-checked
+  uint16_t decodeFrame(FrameFormat format, const uint8_t* rx,
+                       uint16_t& errors) const noexcept; ///< CRC failure ORed into errors
+  uint16_t decodeResponse(const uint8_t* rx) const noexcept; ///< MISO frame -> [ER,Err,Data13:0]
+  uint16_t decodeResponse(const uint8_t* rx, uint16_t& errors) const noexcept;
+  uint16_t transferReadCommand(uint16_t addr,
+                               uint16_t& errors) const; ///< send read cmd, return previous response
+
   // Low level register access helpers
+  uint16_t rawReadFrame(uint16_t addr) const;    ///< cmd + NOP, returns [ER,Err,Data13:0]
+  uint16_t rawReadFrame(uint16_t addr, uint16_t& errors) const;
   uint16_t rawReadRegister(uint16_t addr) const; ///< read register without updating sticky errors
+  uint16_t rawReadRegister(uint16_t addr, uint16_t& errors) const;
   uint16_t readRegister(uint16_t addr) const;    ///< read register and refresh sticky errors
-  bool writeRegister(uint16_t addr, uint16_t val, uint8_t retries) const;
+  uint16_t readRegister(uint16_t addr, uint16_t& errors) const; ///< errors of this read, no sticky
+  uint16_t continuousReadRegister(uint16_t addr) const; ///< pipelined read, one frame steady state
+  uint16_t continuousReadRegister(uint16_t addr, uint16_t& errors) const; ///< errors, no sticky
+  void transferReadCommands(const uint16_t* addrs, std::size_t count, uint8_t* tx,
+                            uint8_t* rx) const; ///< one frame-list transfer of read commands
+  void readRegisterChain(const uint16_t* addrs, uint16_t* out, std::size_t count, uint8_t* tx,
+                         uint8_t* rx) const; ///< N+1 frames; tx/rx hold (count + 2) frames
+  void readRegisterChain(const uint16_t* addrs, uint16_t* out, std::size_t count, uint8_t* tx,
+                         uint8_t* rx, uint16_t& errors) const; ///< errors of the chain, no sticky
+  bool writeRegister(uint16_t addr, uint16_t val, uint8_t retries, WriteVerify verify) const;
+  bool writeRegisterChain(const uint16_t* addrs, const uint16_t* values, std::size_t count,
+                          uint8_t retries, WriteVerify verify, uint8_t* tx,
+                          uint8_t* rx) const; ///< 2N+1 frames; tx/rx hold (2 * count + 1) frames
+  template <typename Sink>
+  std::size_t burstRead(const uint16_t* pattern, std::size_t period, std::size_t samples,
+                        std::span<uint8_t> error_bitmap,
+                        Sink&& sink) const; ///< sink(sample, slot, 14-bit value)
+  void queueDeferredVerify(uint16_t addr, uint16_t val) const; ///< flushes the queue when full
+  bool verifyDeferredWrites() const;                          ///< one chained read of the queue
+
+  template <typename... RegTs>
+  bool writeRegs(uint8_t retries, const RegTs&... regs) const {
+    constexpr std::size_t count = sizeof...(RegTs);
+    const std::array<uint16_t, count> addresses{RegTs::ADDRESS...};
+    const std::array<uint16_t, count> values{encode(regs)...};
+    std::array<uint8_t, ((2U * count) + 1U) * MAX_FRAME_BYTES> tx{};
+    std::array<uint8_t, ((2U * count) + 1U) * MAX_FRAME_BYTES> rx{};
+    return writeRegisterChain(addresses.data(), values.data(), count, retries,
+                              this->write_verify_, tx.data(), rx.data());
+  }
+
+  // Field encodings shared by the setters and ConfigTransaction
+  static uint8_t abiResolutionCode(uint8_t resolution_bits) noexcept; ///< bits -> SETTINGS3 ABIRES
+  static std::pair<uint8_t, uint8_t> filterPresetCodes(FilterPreset preset) noexcept; ///< K codes
+
+  // Configuration cache: one slot per address from DISABLE (0x0015) to SETTINGS3 (0x001A)
+  static constexpr uint16_t CONFIG_CACHE_FIRST = AS5047U_REG::DISABLE::ADDRESS;
+  static constexpr std::size_t CONFIG_CACHE_SIZE =
+      AS5047U_REG::SETTINGS3::ADDRESS - CONFIG_CACHE_FIRST + 1U;
+  static_assert(CONFIG_CACHE_SIZE <= 8, "config_cache_valid_ holds one bit per cached register");
+
+  /// ReadReg() for the configuration setters/getters: served from the cache when valid.
+  template <typename RegT>
+  RegT readConfig() const {
+    constexpr std::size_t slot = RegT::ADDRESS - CONFIG_CACHE_FIRST;
+    static_assert(RegT::ADDRESS >= CONFIG_CACHE_FIRST && slot < CONFIG_CACHE_SIZE,
+                  "readConfig() is only for cached configuration registers");
+    const BusGuard guard(*this); // the cache is shared with storeConfigCache() on other threads
+    if (this->config_cache_enabled_ && (this->config_cache_valid_ & (1U << slot)) != 0U) {
+      return decode<RegT>(this->config_cache_[slot]);
+    }
+    return ReadReg<RegT>();
+  }
+  /// ReadRegResult() counterpart of readConfig(); a cached value carries no errors.
+  template <typename RegT>
+  Result<RegT> readConfigResult() const {
+    constexpr std::size_t slot = RegT::ADDRESS - CONFIG_CACHE_FIRST;
+    const BusGuard guard(*this);
+    if (this->config_cache_enabled_ && (this->config_cache_valid_ & (1U << slot)) != 0U) {
+      return {decode<RegT>(this->config_cache_[slot]), AS5047U_Error::None};
+    }
+    return ReadRegResult<RegT>();
+  }
+  /// Retry loop of the getters: read RegT (through the cache for configuration registers)
+  /// until the read is free of communication errors or the retries run out.
+  template <typename RegT>
+  Result<RegT> readRetried(uint8_t retries) const {
+    constexpr bool cached = RegT::ADDRESS >= CONFIG_CACHE_FIRST &&
+                            RegT::ADDRESS - CONFIG_CACHE_FIRST < CONFIG_CACHE_SIZE;
+    Result<RegT> result{};
+    for (uint8_t i = 0; i <= retries; ++i) {
+      if constexpr (cached) {
+        result = readConfigResult<RegT>();
+      } else {
+        result = ReadRegResult<RegT>();
+      }
+      if (result.Ok()) {
+        break;
+      }
+    }
+    return result;
+  }
+  void storeConfigCache(uint16_t addr, uint16_t val) const noexcept; ///< no-op if not cached
+  void dropConfigCache(uint16_t addr) const noexcept;                ///< no-op if not cached
+
+  // Asynchronous state machine: Idle -> *InFlight (start*) -> Idle (complete*)
+  enum class AsyncState : uint8_t { Idle, ReadInFlight, ContinuousReadInFlight, WriteInFlight };
+  bool startAsyncRead(uint16_t addr)
+    requires ASYNC_TRANSFERS;
+  bool startAsyncContinuousRead(uint16_t addr)
+    requires ASYNC_TRANSFERS;
+  uint16_t completeAsyncRead()
+    requires ASYNC_TRANSFERS;
+  uint16_t completeAsyncRead(uint16_t& errors) ///< errors of this read, no sticky
+    requires ASYNC_TRANSFERS;
+  bool startAsyncWrite(uint16_t addr, uint16_t val)
+    requires ASYNC_TRANSFERS;
+  bool completeAsyncWrite()
+    requires ASYNC_TRANSFERS;
 
   SpiType& spi_;             ///< SPI bus reference
-  FrameFormat frame_format_; ///< current SPI frame format
+  FrameFormat frame_format_; ///< current SPI frame format (runtime-format drivers only)
   uint8_t pad_byte_{0};      ///< pad byte for SPI_32 daisy-chain indexing
+  mutable uint16_t pipeline_address_{NO_PENDING_READ}; ///< address of the response in flight
+  ErrorCheckMode error_check_mode_{AS5047U_CFG::DEFAULT_ERROR_CHECK_MODE}; ///< sticky refresh mode
+  WriteVerify write_verify_{AS5047U_CFG::DEFAULT_WRITE_VERIFY}; ///< write verify policy
+  mutable uint8_t deferred_count_{0}; ///< entries used in deferred_writes_
+  mutable std::array<RegisterWrite, DEFERRED_VERIFY_CAPACITY> deferred_writes_{}; ///< unverified
+
+  AsyncState async_state_{AsyncState::Idle};      ///< asynchronous transfer state
+  uint16_t async_address_{0};                     ///< register being read/written asynchronously
+  uint16_t async_expected_{0};                    ///< value an async write must read back
+  uint8_t async_frames_{0};                       ///< frames in the in-flight sequence
+  FrameFormat async_format_{FrameFormat::SPI_24}; ///< frame format of the in-flight sequence
+  std::array<uint8_t, 3 * MAX_FRAME_BYTES> async_tx_{}; ///< read: cmd,[ERRFL,]NOP; write: cmd,data,NOP
+  std::array<uint8_t, 3 * MAX_FRAME_BYTES> async_rx_{}; ///< responses, valid once done
+
+  bool config_cache_enabled_{AS5047U_CFG::ENABLE_CONFIG_CACHE}; ///< configuration cache on/off
+  mutable uint8_t config_cache_valid_{0}; ///< bit i set: config_cache_[i] mirrors the device
+  mutable std::array<uint16_t, CONFIG_CACHE_SIZE> config_cache_{}; ///< DISABLE..SETTINGS3 values
+
+  /// Clock readings of the last transfers (only stored when the clock policy is enabled).
+  struct FrameTimes {
+    uint64_t command{0};  ///< first command frame of the last transfer
+    uint64_t pipeline{0}; ///< last command frame, whose response is still in flight
+    uint64_t sample{0};   ///< command frame of the value returned by the last read
+  };
+  struct NoFrameTimes {};
+  [[no_unique_address]] mutable std::conditional_t<ClockPolicy::ENABLED, FrameTimes, NoFrameTimes>
+      frame_times_{};
+
+  mutable typename Concurrency::Flags sticky_errors_{}; ///< sticky error bits since last clear
+  [[no_unique_address]] mutable typename Concurrency::Mutex bus_mutex_{}; ///< held per sequence
+
+  /// Holds the bus lock for one multi-frame sequence; compiles away without a locking policy.
+  class BusGuard {
+  public:
+    explicit BusGuard(const AS5047U& driver) noexcept : driver_(driver) {
+      if constexpr (Concurrency::LOCKS_BUS) {
+        driver_.bus_mutex_.lock();
+      }
+    }
+    ~BusGuard() {
+      if constexpr (Concurrency::LOCKS_BUS) {
+        driver_.bus_mutex_.unlock();
+      }
+    }
+    BusGuard(const BusGuard&) = delete;
+    BusGuard& operator=(const BusGuard&) = delete;
 
-  mutable std::atomic<uint16_t> sticky_errors_{0}; ///< sticky error bits since last clear
-  void updateStickyErrors(uint16_t err_fl) const;
+  private:
+    const AS5047U& driver_;
+  };
+  void updateStickyErrors(uint16_t err_fl) const; ///< ERRFL content -> sticky flags
+  /// Clock reading before a transfer of read commands (0 without a clock policy).
+  static uint64_t transferStartTime() noexcept {
+    if constexpr (ClockPolicy::ENABLED && !SupportsFrameTimestamps<SpiType>) {
+      return ClockPolicy::Now();
+    } else {
+      return 0;
+    }
+  }
+  void recordFrameTimes(uint64_t start, std::size_t frames) const noexcept; ///< after a transfer
+  /// The value returned next was latched at the last transfer's first (or, pipelined, the
+  /// previous transfer's last) command frame.
+  void latchSampleTime(bool pipelined) const noexcept {
+    if constexpr (ClockPolicy::ENABLED) {
+      frame_times_.sample = pipelined ? frame_times_.pipeline : frame_times_.command;
+    }
+  }
+  [[nodiscard]] uint64_t sampleTime() const noexcept {
+    if constexpr (ClockPolicy::ENABLED) {
+      return frame_times_.sample;
+    } else {
+      return 0;
+    }
+  }
+  /// One atomic OR into the sticky flags, skipped when there is nothing to add.
+  void mergeStickyErrors(uint16_t errors) const noexcept {
+    if (errors != 0U) {
+      sticky_errors_.fetch_or(errors, std::memory_order_relaxed);
+    }
+  }
 
   // Helper functions implemented inline for templates
   template <typename RegT>
@@ -509,18 +1320,131 @@ private:
     r.value = raw;
     return r;
   }
+
+  template <typename... RegTs, std::size_t... Is>
+  static constexpr std::tuple<RegTs...> decodeChain(const uint16_t* raw,
+                                                    std::index_sequence<Is...> /*unused*/) {
+    return {decode<RegTs>(raw[Is])...};
+  }
+};
+
+/**
+ * @brief Batched edit of the configuration registers, written back in one chained transfer.
+ *
+ * Obtained from AS5047U::BeginConfig(). The first edit loads DISABLE, ZPOSM,
+ * ZPOSL and SETTINGS1-3 in one chained read (registers held in the driver's
+ * configuration cache are taken from there); further edits only change the
+ * local copy. Commit() writes every register whose value changed exactly once,
+ * chaining the writes so that each one is verified by the next command frame:
+ * N dirty registers cost 2N+1 frames. The destructor commits pending edits
+ * unless Abort() was called.
+ *
+ * If the preload keeps failing with a CRC/framing error, the edits are
+ * dropped and Commit() returns false without writing. Write failures are
+ * reported through the sticky error flags. Do not use the driver for other
+ * configuration writes while a transaction is open.
+ *
+ * With a locking concurrency policy the bus lock is held from the preload
+ * until Commit() or Abort() (or the destructor), so edits from other threads
+ * cannot interleave with the read-modify-write. Use a transaction from one
+ * thread only and keep it short.
+ *
+ * @code
+ * {
+ *   auto cfg = encoder.BeginConfig();
+ *   cfg.ConfigureInterface(true, false, false)
+ *       .SetABIResolution(12)
+ *       .SetFilterPreset(FilterPreset::Balanced)
+ *       .SetDirection(false);
+ * } // one preload, then DISABLE, SETTINGS1, SETTINGS2 and SETTINGS3 in 9 frames
+ * @endcode
+ */
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+class AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction {
+public:
+  explicit ConfigTransaction(AS5047U& driver,
+                             uint8_t retries = AS5047U_CFG::CRC_RETRIES) noexcept
+      : driver_(driver), retries_(retries) {}
+
+  /** @brief Commits pending edits unless the transaction was aborted. */
+  ~ConfigTransaction();
+
+  ConfigTransaction(const ConfigTransaction&) = delete;
+  ConfigTransaction& operator=(const ConfigTransaction&) = delete;
+  ConfigTransaction(ConfigTransaction&&) = delete;
+  ConfigTransaction& operator=(ConfigTransaction&&) = delete;
+
+  // Field edits: same meaning as the AS5047U setters of the same name
+  ConfigTransaction& SetZeroPosition(uint16_t angle_lsb);
+  ConfigTransaction& SetDirection(bool clockwise);
+  ConfigTransaction& SetABIResolution(uint8_t resolution_bits);
+  ConfigTransaction& SetUVWPolePairs(uint8_t pairs);
+  ConfigTransaction& SetIndexPulseLength(uint8_t lsb_len);
+  ConfigTransaction& ConfigureInterface(bool abi, bool uvw, bool pwm);
+  ConfigTransaction& SetDynamicAngleCompensation(bool enable);
+  ConfigTransaction& SetAdaptiveFilter(bool enable);
+  ConfigTransaction& SetFilterPreset(FilterPreset preset);
+  ConfigTransaction& SetFilterParameters(uint8_t k_min, uint8_t k_max);
+  ConfigTransaction& Set150CTemperatureMode(bool enable);
+  ConfigTransaction& SetHysteresis(AS5047U_REG::SETTINGS3::Hysteresis hysteresis);
+  ConfigTransaction& SetAngleOutputSource(AS5047U_REG::SETTINGS2::AngleOutputSource source);
+
+  /**
+   * @brief Edit any field of a configuration register.
+   * @tparam RegT DISABLE, ZPOSM, ZPOSL or SETTINGS1-3.
+   * @param edit Callable invoked as edit(RegT&) on the pending value.
+   */
+  template <typename RegT, typename Edit>
+  ConfigTransaction& Modify(Edit&& edit);
+
+  /** @brief Pending value of a configuration register (loads the registers on first use). */
+  template <typename RegT>
+  RegT Get();
+
+  /** @brief True if any pending value differs from the device. */
+  [[nodiscard]] bool IsDirty() const noexcept {
+    return this->dirty_ != 0U;
+  }
+
+  /**
+   * @brief Write every changed register once, as one chained transfer.
+   * @return true if nothing was pending or every write read back correctly.
+   */
+  bool Commit();
+
+  /** @brief Drop all pending edits; nothing is written. */
+  void Abort() noexcept;
+
+private:
+  bool load();             ///< chained read of the registers not in the driver cache
+  void release() noexcept; ///< drop the bus lock taken by load(), if held
+
+  AS5047U& driver_;
+  uint8_t retries_;
+  uint8_t dirty_{0};    ///< bit i set: values_[i] must be written
+  bool loaded_{false};  ///< values_ mirror the device
+  bool failed_{false};  ///< preload failed; edits are ignored until Commit()/Abort()
+  bool locked_{false};  ///< bus lock held since load()
+  std::array<uint16_t, CONFIG_CACHE_SIZE> values_{}; ///< pending DISABLE..SETTINGS3 values
 };
 
 // Template member function definitions must be in header
-template <typename SpiType>
-AS5047U<SpiType>::AS5047U(SpiType& bus, FrameFormat format) noexcept
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::AS5047U(SpiType& bus, FrameFormat format) noexcept
+  requires(!FIXED_FRAME_FORMAT)
     : spi_(bus), frame_format_(format) {
   // No further initialization (use sensor defaults unless configured).
 }
 
-template <typename SpiType>
-inline bool AS5047U<SpiType>::SetDirection(bool clockwise, uint8_t retries) {
-  auto s2 = ReadReg<AS5047U_REG::SETTINGS2>();
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::AS5047U(SpiType& bus) noexcept
+  requires(FIXED_FRAME_FORMAT)
+    : spi_(bus), frame_format_(frameFormat()) {}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+inline bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetDirection(bool clockwise, uint8_t retries) {
+  const BusGuard guard(*this);
+  auto s2 = readConfig<AS5047U_REG::SETTINGS2>();
   s2.bits.DIR = clockwise ? 0 : 1;
   return WriteReg(s2, retries);
 }
@@ -0,0 +1,120 @@
+/**
+ * @file as5047u_bus_manager.hpp
+ * @brief Shared-bus manager for several AS5047U devices on separate chip selects
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ */
+#pragma once
+#include "as5047u.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace as5047u {
+
+/**
+ * @brief Owns N AS5047U encoders on one SPI bus (one CS each) and reads them back to back.
+ *
+ * The AS5047U answers each command in the *next* frame on the same CS, so the manager keeps
+ * one read command in flight per sensor: every ReadAll() sends one frame per sensor that both
+ * returns that sensor's pending sample and requests the next one. Sensor B's command therefore
+ * goes out while sensor A's data is still pending, and a steady-state cycle costs exactly N
+ * frames (a sensor re-primes with one extra frame after any other access to it).
+ *
+ * With a bus that satisfies SupportsAsyncTransfer, all N frames are queued through
+ * begin_transfer() before any is collected, so the SPI peripheral clocks them back to back
+ * without CPU gaps; otherwise the frames are sent in order through transfer().
+ *
+ * Samples are one ReadAll() period old, as with AS5047U::ReadRegContinuous().
+ *
+ * @tparam SpiType SPI device type; one instance per chip select
+ * @tparam N       Number of encoders
+ * @tparam Format  Frame format argument forwarded to AS5047U (runtime by default)
+ * @tparam LogPolicy, Concurrency, ClockPolicy Forwarded to every AS5047U (same defaults).
+ *                 With Locked<> / SpinLocked each encoder's sequences run under its own lock
+ *                 and ReadAll() uses blocking pipelined reads.
+ *
+ * @code
+ * std::array<MyBus*, 3> cs = {&bus_a, &bus_b, &bus_c};
+ * AS5047UBusManager<MyBus, 3> encoders(cs, FrameFormat::SPI_24);
+ * std::array<uint16_t, 3> angles{};
+ * encoders.ReadAngles(angles);
+ * AS5047UBusManager<MyBus, 3, FrameFormat::SPI_24, NullLog, SpinLocked> shared(cs);
+ * @endcode
+ */
+template <typename SpiType, std::size_t N, auto Format = RuntimeFrameFormat{},
+          typename LogPolicy = NullLog, typename Concurrency = SharedFlags,
+          typename ClockPolicy = NullClock>
+class AS5047UBusManager {
+  static_assert(N > 0, "Bus manager needs at least one encoder");
+
+public:
+  using Encoder = AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>;
+
+  /**
+   * @brief Construct encoders with a runtime frame format.
+   * @param buses  One SPI device per chip select.
+   * @param format Frame format for every encoder.
+   */
+  explicit AS5047UBusManager(const std::array<SpiType*, N>& buses,
+                             FrameFormat format = AS5047U_CFG::DEFAULT_FRAME_FORMAT) noexcept
+    requires(!Encoder::FIXED_FRAME_FORMAT)
+      : encoders_(makeEncoders(buses, format, std::make_index_sequence<N>{})) {}
+
+  /**
+   * @brief Construct encoders whose frame format is fixed by the template argument.
+   * @param buses One SPI device per chip select.
+   */
+  explicit AS5047UBusManager(const std::array<SpiType*, N>& buses) noexcept
+    requires(Encoder::FIXED_FRAME_FORMAT)
+      : encoders_(makeEncoders(buses, std::make_index_sequence<N>{})) {}
+
+  /**
+   * @brief Read RegT from every encoder, one pipelined frame per encoder.
+   * @param out Decoded register per encoder (index = position in the constructor array).
+   */
+  template <typename RegT>
+  void ReadAll(std::array<RegT, N>& out);
+
+  /**
+   * @brief Read the DAEC-compensated angle (ANGLECOM) of every encoder.
+   * @param out 14-bit angle per encoder.
+   */
+  void ReadAngles(std::array<uint16_t, N>& out);
+
+  /** @brief Access one encoder (configuration, sticky error flags, single reads). */
+  Encoder& operator[](std::size_t index) noexcept {
+    return encoders_[index];
+  }
+  const Encoder& operator[](std::size_t index) const noexcept {
+    return encoders_[index];
+  }
+
+  /** @brief Number of managed encoders. */
+  static constexpr std::size_t size() noexcept {
+    return N;
+  }
+
+private:
+  template <std::size_t... Is>
+  static std::array<Encoder, N> makeEncoders(const std::array<SpiType*, N>& buses,
+                                             FrameFormat format, std::index_sequence<Is...> /*unused*/) {
+    return {Encoder(*buses[Is], format)...};
+  }
+
+  template <std::size_t... Is>
+  static std::array<Encoder, N> makeEncoders(const std::array<SpiType*, N>& buses,
+                                             std::index_sequence<Is...> /*unused*/) {
+    return {Encoder(*buses[Is])...};
+  }
+
+  std::array<Encoder, N> encoders_;
+};
+
+} // namespace as5047u
+
+// Include template implementation
+#define AS5047U_BUS_MANAGER_HEADER_INCLUDED
+// NOLINTNEXTLINE(bugprone-suspicious-include) - Intentional: template implementation file
+#include "../src/as5047u_bus_manager.ipp"
+#undef AS5047U_BUS_MANAGER_HEADER_INCLUDED
@@ -0,0 +1,113 @@
+/**
+ * @file as5047u_clock.hpp
+ * @brief Clock policies for timestamping AS5047U samples
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ *
+ * The AS5047U answers a read in the frame after the command, so a value is
+ * sampled when its *command* frame is clocked, not when the response arrives.
+ * The driver reads the clock policy at that frame boundary and returns the
+ * tick count with every timestamped sample (EncoderSample::timestamp, the
+ * *Timed() getters). Buses that capture CS edges themselves can report them
+ * through the optional frame_timestamp() hook (SupportsFrameTimestamps) for
+ * exact instants.
+ *
+ * A policy provides `static uint64_t Now() noexcept`, `TICKS_PER_SECOND`
+ * (0 if unknown) and `ENABLED`. NullClock (the driver default) disables
+ * timestamping and costs nothing.
+ */
+#pragma once
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace as5047u {
+
+/** @brief No timestamps: Now() is 0 and the driver skips all clock reads. */
+struct NullClock {
+  static constexpr bool ENABLED = false;
+  static constexpr uint64_t TICKS_PER_SECOND = 0;
+  static uint64_t Now() noexcept {
+    return 0;
+  }
+};
+
+/** @brief std::chrono::steady_clock in nanoseconds. */
+struct SteadyClock {
+  static constexpr bool ENABLED = true;
+  static constexpr uint64_t TICKS_PER_SECOND = 1'000'000'000ULL;
+  static uint64_t Now() noexcept {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+  }
+};
+
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__) || defined(__XTENSA__)
+#define AS5047U_HAS_CYCLE_COUNTER 1
+/**
+ * @brief CPU cycle / timer counter read in a single instruction.
+ *
+ * x86: TSC; AArch64: CNTVCT_EL0; Xtensa (ESP32): CCOUNT, 32 bits, so it wraps every
+ * 2^32 cycles (about 18 s at 240 MHz).
+ *
+ * @tparam TicksPerSecond Counter frequency on the target (0 if not known).
+ */
+template <uint64_t TicksPerSecond = 0>
+struct CycleCounterClock {
+  static constexpr bool ENABLED = true;
+  static constexpr uint64_t TICKS_PER_SECOND = TicksPerSecond;
+  static uint64_t Now() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    return static_cast<uint64_t>(__rdtsc());
+#elif defined(__aarch64__)
+    uint64_t ticks = 0;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    uint32_t ticks = 0;
+    asm volatile("rsr %0, ccount" : "=a"(ticks));
+    return ticks;
+#endif
+  }
+};
+#else
+#define AS5047U_HAS_CYCLE_COUNTER 0
+#endif
+
+/**
+ * @brief Timestamps from a user function, e.g. esp_timer_get_time() or a hardware timer.
+ *
+ * Any function or captureless lambda returning an integer works; a signed
+ * count such as esp_timer_get_time()'s int64_t is converted to uint64_t.
+ *
+ * @code
+ * using EspTimerClock = CallbackClock<esp_timer_get_time, 1'000'000>; // microseconds
+ * @endcode
+ *
+ * @tparam NowFn          Function returning the current tick count
+ * @tparam TicksPerSecond Tick frequency (0 if not known)
+ */
+template <auto NowFn, uint64_t TicksPerSecond = 0>
+  requires std::integral<std::invoke_result_t<decltype(NowFn)>>
+struct CallbackClock {
+  static constexpr bool ENABLED = true;
+  static constexpr uint64_t TICKS_PER_SECOND = TicksPerSecond;
+  static uint64_t Now() noexcept {
+    return static_cast<uint64_t>(NowFn());
+  }
+};
+
+/// A clock policy has static Now(), TICKS_PER_SECOND and ENABLED.
+template <typename C>
+concept TimestampClock = requires {
+  { C::Now() } -> std::convertible_to<uint64_t>;
+  { C::TICKS_PER_SECOND } -> std::convertible_to<uint64_t>;
+  { C::ENABLED } -> std::convertible_to<bool>;
+};
+
+} // namespace as5047u
@@ -0,0 +1,156 @@
+/**
+ * @file as5047u_concurrency.hpp
+ * @brief Concurrency policies for the AS5047U driver
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ *
+ * A policy is the Concurrency template argument of AS5047U and decides two
+ * things: how the sticky error word is stored (Flags) and whether every
+ * multi-frame bus sequence (command + NOP, write + read-back, ERRFL follow-up,
+ * chained transfers) runs under a bus lock (Mutex):
+ *
+ * | Policy           | Sticky flags       | Bus lock                     |
+ * |------------------|--------------------|------------------------------|
+ * | SingleThreaded   | plain uint16_t     | none                         |
+ * | SharedFlags      | std::atomic        | none (default, as before)    |
+ * | Locked<Mutex>    | std::atomic        | Mutex, held per sequence     |
+ * | SpinLocked       | std::atomic        | SpinLock, held per sequence  |
+ */
+#pragma once
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <thread>
+
+namespace as5047u {
+
+/// Sticky error word without atomics: the std::atomic subset the driver uses, for a single owner.
+class PlainFlags {
+public:
+  uint16_t load(std::memory_order /*order*/ = std::memory_order_seq_cst) const noexcept {
+    return value_;
+  }
+  uint16_t fetch_or(uint16_t bits, std::memory_order /*order*/ = std::memory_order_seq_cst) noexcept {
+    const uint16_t old = value_;
+    value_ = static_cast<uint16_t>(old | bits);
+    return old;
+  }
+  uint16_t exchange(uint16_t value, std::memory_order /*order*/ = std::memory_order_seq_cst) noexcept {
+    const uint16_t old = value_;
+    value_ = value;
+    return old;
+  }
+
+private:
+  uint16_t value_{0};
+};
+
+/// Lock that does nothing (policies without a bus lock).
+struct NullLock {
+  void lock() noexcept {}
+  void unlock() noexcept {}
+};
+
+/**
+ * @brief Test-and-set spinlock for short critical sections shared between RTOS tasks.
+ *
+ * A multi-frame sequence holds it for a few microseconds of SPI clocking; waiters
+ * yield between attempts. Not for use from interrupt handlers.
+ */
+class SpinLock {
+public:
+  void lock() noexcept {
+    while (flag_.test_and_set(std::memory_order_acquire)) {
+      while (flag_.test(std::memory_order_relaxed)) {
+        std::this_thread::yield();
+      }
+    }
+  }
+  void unlock() noexcept {
+    flag_.clear(std::memory_order_release);
+  }
+
+private:
+  std::atomic_flag flag_{};
+};
+
+/**
+ * @brief Wraps a Mutex so the thread that holds it can take it again.
+ *
+ * Driver sequences nest (a write falls back to an ERRFL read, a deferred-verify
+ * flush runs a chained read); only the outermost level locks Mutex. The owner
+ * id is only ever set to the caller's own id, so comparing it needs no lock.
+ */
+template <typename Mutex>
+class ReentrantLock {
+public:
+  void lock() {
+    const auto self = std::this_thread::get_id();
+    if (owner_.load(std::memory_order_relaxed) == self) {
+      ++depth_;
+      return;
+    }
+    mutex_.lock();
+    owner_.store(self, std::memory_order_relaxed);
+    depth_ = 1;
+  }
+  void unlock() {
+    if (--depth_ == 0U) {
+      owner_.store(std::thread::id{}, std::memory_order_relaxed);
+      mutex_.unlock();
+    }
+  }
+
+private:
+  Mutex mutex_{};
+  std::atomic<std::thread::id> owner_{};
+  uint32_t depth_{0}; ///< nesting level, touched only by the owner
+};
+
+/** @brief One driver per thread: no atomics, no lock. */
+struct SingleThreaded {
+  using Flags = PlainFlags;
+  using Mutex = NullLock;
+  static constexpr bool LOCKS_BUS = false;
+};
+
+/**
+ * @brief Default: sticky flags readable from another thread, bus sequences unsynchronized.
+ *
+ * Matches the driver's behaviour before policies existed; the owner of the bus
+ * must still serialize driver calls itself.
+ */
+struct SharedFlags {
+  using Flags = std::atomic<uint16_t>;
+  using Mutex = NullLock;
+  static constexpr bool LOCKS_BUS = false;
+};
+
+/**
+ * @brief Thread-safe driver: each multi-frame sequence runs under a Mutex.
+ * @tparam MutexT Any type with lock()/unlock() (std::mutex, an RTOS mutex wrapper, SpinLock).
+ *
+ * The asynchronous and coroutine APIs are unavailable with a locking policy: their
+ * sequences span several calls, possibly on different threads.
+ */
+template <typename MutexT>
+struct Locked {
+  using Flags = std::atomic<uint16_t>;
+  using Mutex = ReentrantLock<MutexT>;
+  static constexpr bool LOCKS_BUS = true;
+};
+
+/// Thread-safe driver for RTOS tasks that must not block on a kernel mutex.
+using SpinLocked = Locked<SpinLock>;
+
+/// A concurrency policy names a Flags word, a Mutex and whether it locks the bus.
+template <typename P>
+concept ConcurrencyPolicy = requires(typename P::Flags& flags, typename P::Mutex& mutex) {
+  { P::LOCKS_BUS } -> std::convertible_to<bool>;
+  flags.fetch_or(uint16_t{0}, std::memory_order_relaxed);
+  flags.exchange(uint16_t{0});
+  flags.load(std::memory_order_relaxed);
+  mutex.lock();
+  mutex.unlock();
+};
+
+} // namespace as5047u
@@ -6,7 +6,7 @@
 #pragma once
 #include <cstdint>
 
-#include "as5047u_types.hpp" // For FrameFormat enum
+#include "as5047u_types.hpp" // For FrameFormat, ErrorCheckMode and WriteVerify enums
 
 // This header provides default configuration values for the AS5047U driver.
 // It can be generated from a Kconfig system or edited manually.
@@ -25,4 +25,24 @@ inline constexpr uint8_t CRC_RETRIES = CONFIG_AS5047U_CRC_RETRIES;
 #else
 inline constexpr uint8_t CRC_RETRIES = 0;
 #endif
+
+#ifdef CONFIG_AS5047U_ERROR_CHECK_IN_FRAME
+inline constexpr ErrorCheckMode DEFAULT_ERROR_CHECK_MODE = ErrorCheckMode::InFrame;
+#else
+inline constexpr ErrorCheckMode DEFAULT_ERROR_CHECK_MODE = ErrorCheckMode::ReadErrfl;
+#endif
+
+#ifdef CONFIG_AS5047U_WRITE_VERIFY_DEFERRED
+inline constexpr WriteVerify DEFAULT_WRITE_VERIFY = WriteVerify::Deferred;
+#elif defined(CONFIG_AS5047U_WRITE_VERIFY_NONE)
+inline constexpr WriteVerify DEFAULT_WRITE_VERIFY = WriteVerify::None;
+#else
+inline constexpr WriteVerify DEFAULT_WRITE_VERIFY = WriteVerify::Immediate;
+#endif
+
+#ifdef CONFIG_AS5047U_CONFIG_CACHE
+inline constexpr bool ENABLE_CONFIG_CACHE = true;
+#else
+inline constexpr bool ENABLE_CONFIG_CACHE = false;
+#endif
 } // namespace AS5047U_CFG
@@ -0,0 +1,222 @@
+/**
+ * @file as5047u_crc.hpp
+ * @brief Table-driven and batch CRC8 engine for AS5047U SPI frames
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ *
+ * The AS5047U protects each 16-bit frame word with CRC8 (polynomial 0x1D,
+ * initial value 0xC4, final XOR 0xFF, MSB first). This header provides:
+ * - Crc8Bitwise(): the bit-serial reference (16 shift/XOR steps per word)
+ * - Crc8():        two lookups in a constexpr 256-entry table
+ * - Crc8Batch() / Crc8VerifyBatch(): many words at once, vectorised with
+ *   SSSE3 (also used on SSE4.x targets), AVX2 or AArch64 NEON when the
+ *   compiler targets them, scalar table lookups otherwise.
+ *
+ * The SIMD paths use the fact that CRC is affine over GF(2):
+ * crc(d) = crc(0) ^ N0[d & 0xF] ^ N1[(d >> 4) & 0xF] ^ N2[(d >> 8) & 0xF] ^
+ * N3[d >> 12], where each Nk is a 16-entry table that fits one byte-shuffle
+ * register. All tables are generated at compile time from Crc8Bitwise().
+ */
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define AS5047U_CRC8_SIMD_AVX2 1
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define AS5047U_CRC8_SIMD_SSSE3 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define AS5047U_CRC8_SIMD_NEON 1
+#endif
+
+namespace as5047u {
+
+/// CRC8 parameters of the AS5047U SPI protocol.
+inline constexpr uint8_t CRC8_POLY = 0x1D;
+inline constexpr uint8_t CRC8_INIT = 0xC4;
+inline constexpr uint8_t CRC8_XOR_OUT = 0xFF;
+
+/**
+ * @brief Bit-serial reference CRC8 over a 16-bit frame word.
+ *
+ * Kept as the specification of the checksum; the tables below are derived
+ * from it and Crc8() must agree with it for every input.
+ */
+constexpr uint8_t Crc8Bitwise(uint16_t data16) noexcept {
+  uint8_t crc = CRC8_INIT;
+  for (int i = 0; i < 16; ++i) {
+    bool bit = ((data16 >> (15 - i)) & 1) ^ ((crc >> 7) & 1);
+    crc = static_cast<uint8_t>((crc << 1) ^ (bit ? CRC8_POLY : 0x00));
+  }
+  return crc ^ CRC8_XOR_OUT;
+}
+
+namespace detail {
+
+constexpr std::array<uint8_t, 256> makeCrc8Table() noexcept {
+  std::array<uint8_t, 256> table{};
+  for (unsigned i = 0; i < 256; ++i) {
+    uint8_t crc = static_cast<uint8_t>(i);
+    for (int b = 0; b < 8; ++b) {
+      crc = static_cast<uint8_t>((crc & 0x80) ? ((crc << 1) ^ CRC8_POLY) : (crc << 1));
+    }
+    table[i] = crc;
+  }
+  return table;
+}
+
+/// Linear contribution of nibble @p shift/4 of the frame word (crc(0) removed).
+constexpr std::array<uint8_t, 16> makeCrc8NibbleTable(unsigned shift) noexcept {
+  std::array<uint8_t, 16> table{};
+  for (unsigned v = 0; v < 16; ++v) {
+    table[v] = Crc8Bitwise(static_cast<uint16_t>(v << shift)) ^ Crc8Bitwise(0);
+  }
+  return table;
+}
+
+} // namespace detail
+
+/// Byte-wise CRC8 table for polynomial 0x1D (no init / final XOR applied).
+inline constexpr std::array<uint8_t, 256> CRC8_TABLE = detail::makeCrc8Table();
+
+/// Per-nibble tables used by the batch engine (bits 3:0, 7:4, 11:8, 15:12).
+alignas(16) inline constexpr std::array<std::array<uint8_t, 16>, 4> CRC8_NIBBLE_TABLES = {
+    detail::makeCrc8NibbleTable(0), detail::makeCrc8NibbleTable(4),
+    detail::makeCrc8NibbleTable(8), detail::makeCrc8NibbleTable(12)};
+
+/// CRC of the all-zero word; the affine offset added back by the batch engine.
+inline constexpr uint8_t CRC8_ZERO = Crc8Bitwise(0);
+
+/**
+ * @brief Table-driven CRC8 over a 16-bit frame word (two lookups).
+ */
+constexpr uint8_t Crc8(uint16_t data16) noexcept {
+  uint8_t crc = CRC8_TABLE[CRC8_INIT ^ static_cast<uint8_t>(data16 >> 8)];
+  crc = CRC8_TABLE[crc ^ static_cast<uint8_t>(data16 & 0xFF)];
+  return crc ^ CRC8_XOR_OUT;
+}
+
+static_assert(Crc8(0x0000) == Crc8Bitwise(0x0000) && Crc8(0x3FFF) == Crc8Bitwise(0x3FFF) &&
+                  Crc8(0xC000) == Crc8Bitwise(0xC000) && Crc8(0x4016) == Crc8Bitwise(0x4016),
+              "CRC8 table does not match the bit-serial reference");
+
+/// Name of the batch backend selected at compile time ("avx2", "ssse3", "neon", "scalar").
+#if defined(AS5047U_CRC8_SIMD_AVX2)
+inline constexpr const char* CRC8_BATCH_BACKEND = "avx2";
+#elif defined(AS5047U_CRC8_SIMD_SSSE3)
+inline constexpr const char* CRC8_BATCH_BACKEND = "ssse3";
+#elif defined(AS5047U_CRC8_SIMD_NEON)
+inline constexpr const char* CRC8_BATCH_BACKEND = "neon";
+#else
+inline constexpr const char* CRC8_BATCH_BACKEND = "scalar";
+#endif
+
+/**
+ * @brief Compute the CRC8 of @p count frame words.
+ * @param data  Frame words (no alignment requirement).
+ * @param crc   Output, one CRC byte per word.
+ * @param count Number of words.
+ */
+inline void Crc8Batch(const uint16_t* data, uint8_t* crc, std::size_t count) noexcept {
+  std::size_t i = 0;
+#if defined(AS5047U_CRC8_SIMD_AVX2)
+  const __m256i t0 = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(CRC8_NIBBLE_TABLES[0].data())));
+  const __m256i t1 = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(CRC8_NIBBLE_TABLES[1].data())));
+  const __m256i t2 = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(CRC8_NIBBLE_TABLES[2].data())));
+  const __m256i t3 = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(CRC8_NIBBLE_TABLES[3].data())));
+  const __m256i low_byte = _mm256_set1_epi16(0x00FF);
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  const __m256i offset = _mm256_set1_epi8(static_cast<char>(CRC8_ZERO));
+  for (; i + 32 <= count; i += 32) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 16));
+    // packus interleaves 128-bit lanes; permute restores word order
+    __m256i lo = _mm256_permute4x64_epi64(
+        _mm256_packus_epi16(_mm256_and_si256(a, low_byte), _mm256_and_si256(b, low_byte)), 0xD8);
+    __m256i hi = _mm256_permute4x64_epi64(
+        _mm256_packus_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8)), 0xD8);
+    __m256i r = _mm256_xor_si256(
+        _mm256_shuffle_epi8(t0, _mm256_and_si256(lo, nibble)),
+        _mm256_shuffle_epi8(t1, _mm256_and_si256(_mm256_srli_epi16(lo, 4), nibble)));
+    r = _mm256_xor_si256(r, _mm256_shuffle_epi8(t2, _mm256_and_si256(hi, nibble)));
+    r = _mm256_xor_si256(
+        r, _mm256_shuffle_epi8(t3, _mm256_and_si256(_mm256_srli_epi16(hi, 4), nibble)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(crc + i), _mm256_xor_si256(r, offset));
+  }
+#elif defined(AS5047U_CRC8_SIMD_SSSE3)
+  const __m128i t0 = _mm_load_si128(reinterpret_cast<const __m128i*>(CRC8_NIBBLE_TABLES[0].data()));
+  const __m128i t1 = _mm_load_si128(reinterpret_cast<const __m128i*>(CRC8_NIBBLE_TABLES[1].data()));
+  const __m128i t2 = _mm_load_si128(reinterpret_cast<const __m128i*>(CRC8_NIBBLE_TABLES[2].data()));
+  const __m128i t3 = _mm_load_si128(reinterpret_cast<const __m128i*>(CRC8_NIBBLE_TABLES[3].data()));
+  const __m128i low_byte = _mm_set1_epi16(0x00FF);
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  const __m128i offset = _mm_set1_epi8(static_cast<char>(CRC8_ZERO));
+  for (; i + 16 <= count; i += 16) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 8));
+    __m128i lo = _mm_packus_epi16(_mm_and_si128(a, low_byte), _mm_and_si128(b, low_byte));
+    __m128i hi = _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+    __m128i r = _mm_xor_si128(_mm_shuffle_epi8(t0, _mm_and_si128(lo, nibble)),
+                              _mm_shuffle_epi8(t1, _mm_and_si128(_mm_srli_epi16(lo, 4), nibble)));
+    r = _mm_xor_si128(r, _mm_shuffle_epi8(t2, _mm_and_si128(hi, nibble)));
+    r = _mm_xor_si128(r, _mm_shuffle_epi8(t3, _mm_and_si128(_mm_srli_epi16(hi, 4), nibble)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(crc + i), _mm_xor_si128(r, offset));
+  }
+#elif defined(AS5047U_CRC8_SIMD_NEON)
+  const uint8x16_t t0 = vld1q_u8(CRC8_NIBBLE_TABLES[0].data());
+  const uint8x16_t t1 = vld1q_u8(CRC8_NIBBLE_TABLES[1].data());
+  const uint8x16_t t2 = vld1q_u8(CRC8_NIBBLE_TABLES[2].data());
+  const uint8x16_t t3 = vld1q_u8(CRC8_NIBBLE_TABLES[3].data());
+  const uint8x16_t nibble = vdupq_n_u8(0x0F);
+  const uint8x16_t offset = vdupq_n_u8(CRC8_ZERO);
+  for (; i + 16 <= count; i += 16) {
+    uint16x8_t a = vld1q_u16(data + i);
+    uint16x8_t b = vld1q_u16(data + i + 8);
+    uint8x16_t lo = vcombine_u8(vmovn_u16(a), vmovn_u16(b));
+    uint8x16_t hi = vcombine_u8(vshrn_n_u16(a, 8), vshrn_n_u16(b, 8));
+    uint8x16_t r = veorq_u8(vqtbl1q_u8(t0, vandq_u8(lo, nibble)), vqtbl1q_u8(t1, vshrq_n_u8(lo, 4)));
+    r = veorq_u8(r, vqtbl1q_u8(t2, vandq_u8(hi, nibble)));
+    r = veorq_u8(r, vqtbl1q_u8(t3, vshrq_n_u8(hi, 4)));
+    vst1q_u8(crc + i, veorq_u8(r, offset));
+  }
+#endif
+  for (; i < count; ++i) {
+    crc[i] = Crc8(data[i]);
+  }
+}
+
+/**
+ * @brief Check @p count frame words against their received CRC bytes.
+ * @param data     Frame words.
+ * @param crc      Received CRC byte for each word.
+ * @param count    Number of words.
+ * @param mismatch Optional output, one byte per word: 1 if the CRC is wrong, 0 if it matches.
+ * @return Number of words whose CRC does not match.
+ */
+inline std::size_t Crc8VerifyBatch(const uint16_t* data, const uint8_t* crc, std::size_t count,
+                                   uint8_t* mismatch = nullptr) noexcept {
+  constexpr std::size_t CHUNK = 64;
+  uint8_t calc[CHUNK];
+  std::size_t bad = 0;
+  for (std::size_t base = 0; base < count; base += CHUNK) {
+    std::size_t n = (count - base < CHUNK) ? (count - base) : CHUNK;
+    Crc8Batch(data + base, calc, n);
+    for (std::size_t k = 0; k < n; ++k) {
+      uint8_t m = calc[k] != crc[base + k];
+      bad += m;
+      if (mismatch) {
+        mismatch[base + k] = m;
+      }
+    }
+  }
+  return bad;
+}
+
+} // namespace as5047u
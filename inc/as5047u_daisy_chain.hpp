@@ -0,0 +1,180 @@
+/**
+ * @file as5047u_daisy_chain.hpp
+ * @brief Daisy-chain driver for N AS5047U devices sharing one chip select
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ */
+#pragma once
+#include "as5047u.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace as5047u {
+
+/**
+ * @brief N AS5047U devices daisy-chained on one CS, read and written in one shifted transfer.
+ *
+ * In a daisy chain (MOSI -> dev -> dev -> ... -> MISO, common CS and SCLK) every device uses
+ * 32-bit frames and the host clocks N x 4 bytes per CS cycle. Each 32-bit slot of the
+ * transfer carries one device's command; its pad byte (byte 0 on MOSI, byte 3 on MISO) is set
+ * to the slot index, and the responses are demultiplexed by that echoed pad, so the result
+ * order does not depend on which end of the chain the host sees first.
+ *
+ * Device index i always refers to the device that receives MOSI slot i. Every chain access is
+ * one spi_.transfer() of N x 4 bytes, and all N response CRCs are checked in one
+ * Crc8VerifyBatch() pass.
+ *
+ * @tparam SpiType SPI bus type (as5047u::SpiInterface<SpiType>); one transfer() = one CS cycle
+ * @tparam N       Number of devices in the chain (1-255)
+ * @tparam LogPolicy   Receives a WriteVerifyFailed record per device that fails WriteAll()
+ * @tparam Concurrency Sticky-flag storage and bus locking, as for AS5047U; with
+ *                     Locked<> / SpinLocked every chain access holds the lock
+ * @tparam ClockPolicy Time base of GetSampleTime() (NullClock: no timestamps)
+ *
+ * @code
+ * AS5047UDaisyChain<MyBus, 6> arm(bus);
+ * std::array<uint16_t, 6> joints{};
+ * if (arm.ReadAngles(joints)) { ... }
+ * @endcode
+ */
+template <typename SpiType, std::size_t N, typename LogPolicy = NullLog,
+          typename Concurrency = SharedFlags, typename ClockPolicy = NullClock>
+class AS5047UDaisyChain {
+  static_assert(N > 0 && N < 256, "Daisy chain length must be 1-255 (pad byte indexes devices)");
+  static_assert(DriverLog<LogPolicy>, "Daisy chain log policy needs a static Log(const LogRecord&)");
+  static_assert(ConcurrencyPolicy<Concurrency>,
+                "Daisy chain concurrency policy needs Flags, Mutex and LOCKS_BUS");
+  static_assert(TimestampClock<ClockPolicy>,
+                "Daisy chain clock policy needs static Now(), TICKS_PER_SECOND and ENABLED");
+
+public:
+  static constexpr std::size_t FRAME_BYTES = 4;                ///< SPI_32 frame per device
+  static constexpr std::size_t CHAIN_BYTES = N * FRAME_BYTES;  ///< bytes per CS cycle
+
+  /**
+   * @brief Construct a chain driver.
+   * @param bus SPI bus whose CS frames all N devices.
+   */
+  explicit AS5047UDaisyChain(SpiType& bus) noexcept;
+
+  /**
+   * @brief Read the same register from every device (command cycle + NOP cycle).
+   * @tparam RegT Register type (must have an ADDRESS static member).
+   * @param out Decoded register per device.
+   * @return true if every device answered with a valid CRC.
+   */
+  template <typename RegT>
+  bool ReadAll(std::array<RegT, N>& out);
+
+  /**
+   * @brief Pipelined read: one CS cycle per call in steady state.
+   *
+   * Sends the read command for RegT again and returns the responses to the previous one,
+   * like AS5047U::ReadRegContinuous(). A priming cycle is added if the previous chain access
+   * was for another address.
+   */
+  template <typename RegT>
+  bool ReadAllContinuous(std::array<RegT, N>& out);
+
+  /**
+   * @brief Read the DAEC-compensated angle (ANGLECOM) of every device, pipelined.
+   * @param out 14-bit angle per device.
+   * @return true if every device answered with a valid CRC.
+   */
+  bool ReadAngles(std::array<uint16_t, N>& out);
+
+  /**
+   * @brief Write one value per device and verify it (command, data and NOP cycles).
+   * @return true if every device read back its value.
+   */
+  template <typename RegT>
+  bool WriteAll(const std::array<RegT, N>& regs);
+
+  /** @brief Write the same value to every device (see WriteAll(const std::array&)). */
+  template <typename RegT>
+  bool WriteAll(const RegT& reg);
+
+  /**
+   * @brief Retrieve and clear the sticky error flags of one device.
+   * @param device Device index (MOSI slot).
+   */
+  AS5047U_Error GetStickyErrorFlags(std::size_t device);
+
+  /**
+   * @brief Clock-policy ticks at the command cycle of the values returned by the last read.
+   *
+   * For ReadAllContinuous() / ReadAngles() that is the previous call's cycle. 0 with NullClock.
+   */
+  [[nodiscard]] uint64_t GetSampleTime() const noexcept {
+    if constexpr (ClockPolicy::ENABLED) {
+      return times_.sample;
+    } else {
+      return 0;
+    }
+  }
+
+private:
+  static constexpr uint16_t NO_PENDING_READ = 0xFFFF;
+  static constexpr uint16_t FRAME_STATUS_MASK = 0xC000;
+  static constexpr uint16_t ERRFL_STICKY_MASK = 0x06FF; ///< ERRFL bits 0-7, 9, 10
+  static constexpr std::size_t SPI_32_IMAGE = static_cast<std::size_t>(FrameFormat::SPI_32);
+
+  void loadCommand(const FrameImage& image) noexcept; ///< same command in every slot
+  void loadData(const uint16_t* values) noexcept;     ///< per-slot write data frames
+  bool transferAndDemux(uint16_t* frames);            ///< one CS cycle; frames indexed by device
+  /// Chain ERRFL read on status bits; returns ERRFL per device (all 0 if not read).
+  std::array<uint16_t, N> refreshErrors(const uint16_t* frames, bool force);
+
+  /// Holds the bus lock for one chain access; compiles away without a locking policy.
+  class ChainGuard {
+  public:
+    explicit ChainGuard(AS5047UDaisyChain& chain) noexcept : chain_(chain) {
+      if constexpr (Concurrency::LOCKS_BUS) {
+        chain_.bus_mutex_.lock();
+      }
+    }
+    ~ChainGuard() {
+      if constexpr (Concurrency::LOCKS_BUS) {
+        chain_.bus_mutex_.unlock();
+      }
+    }
+    ChainGuard(const ChainGuard&) = delete;
+    ChainGuard& operator=(const ChainGuard&) = delete;
+
+  private:
+    AS5047UDaisyChain& chain_;
+  };
+
+  /// Clock reading now, or 0 without a clock policy.
+  static uint64_t clockNow() noexcept {
+    if constexpr (ClockPolicy::ENABLED) {
+      return ClockPolicy::Now();
+    } else {
+      return 0;
+    }
+  }
+  /// Command-cycle times (only stored when the clock policy is enabled).
+  struct ChainTimes {
+    uint64_t pipeline{0}; ///< cycle of the command still in flight
+    uint64_t sample{0};   ///< cycle of the values returned by the last read
+  };
+  struct NoChainTimes {};
+
+  SpiType& spi_;
+  uint16_t pipeline_address_{NO_PENDING_READ};
+  std::array<uint8_t, CHAIN_BYTES> tx_{};
+  std::array<uint8_t, CHAIN_BYTES> rx_{};
+  std::array<typename Concurrency::Flags, N> sticky_errors_{};
+  [[no_unique_address]] typename Concurrency::Mutex bus_mutex_{}; ///< held per chain access
+  [[no_unique_address]] std::conditional_t<ClockPolicy::ENABLED, ChainTimes, NoChainTimes> times_{};
+};
+
+} // namespace as5047u
+
+// Include template implementation
+#define AS5047U_DAISY_CHAIN_HEADER_INCLUDED
+// NOLINTNEXTLINE(bugprone-suspicious-include) - Intentional: template implementation file
+#include "../src/as5047u_daisy_chain.ipp"
+#undef AS5047U_DAISY_CHAIN_HEADER_INCLUDED
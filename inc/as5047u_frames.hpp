@@ -0,0 +1,144 @@
+/**
+ * @file as5047u_frames.hpp
+ * @brief Compile-time MOSI frame images for every AS5047U register command
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ *
+ * Register addresses are compile-time constants, so the read and write command
+ * frames of every register (including their CRC byte) are generated here once,
+ * per frame format, and placed in read-only data. The driver copies these images
+ * instead of encoding the command and computing its CRC on every access; only
+ * write data frames still need a CRC at run time.
+ */
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "as5047u_crc.hpp"
+#include "as5047u_registers.hpp"
+#include "as5047u_types.hpp"
+
+namespace as5047u {
+
+/// One MOSI frame as sent on the wire (2, 3 or 4 bytes used depending on the format).
+using FrameImage = std::array<uint8_t, 4>;
+
+/**
+ * @brief Build the MOSI image of a 16-bit payload.
+ *
+ * SPI_16: [payload 15:8, payload 7:0]; SPI_24: [.., .., CRC];
+ * SPI_32: [pad, .., .., CRC] with pad = 0 (the driver patches in its pad byte).
+ */
+constexpr FrameImage MakeFrameImage(FrameFormat format, uint16_t payload) noexcept {
+  const auto hi = static_cast<uint8_t>(payload >> 8);
+  const auto lo = static_cast<uint8_t>(payload & 0xFF);
+  if (format == FrameFormat::SPI_16) {
+    return {hi, lo, 0, 0};
+  }
+  if (format == FrameFormat::SPI_24) {
+    return {hi, lo, Crc8(payload), 0};
+  }
+  return {0, hi, lo, Crc8(payload)};
+}
+
+/**
+ * @brief Read and write command images of one register address.
+ *
+ * Index read/write with static_cast<std::size_t>(FrameFormat).
+ */
+struct CommandFrameSet {
+  uint16_t address;                ///< 14-bit register address
+  std::array<FrameImage, 3> read;  ///< bit14=1 | address
+  std::array<FrameImage, 3> write; ///< bit14=0 | address
+};
+
+/// Build the command images of @p address for all three frame formats.
+constexpr CommandFrameSet MakeCommandFrameSet(uint16_t address) noexcept {
+  const auto addr = static_cast<uint16_t>(address & 0x3FFF);
+  const auto rd = static_cast<uint16_t>(0x4000 | addr);
+  return {addr,
+          {MakeFrameImage(FrameFormat::SPI_16, rd), MakeFrameImage(FrameFormat::SPI_24, rd),
+           MakeFrameImage(FrameFormat::SPI_32, rd)},
+          {MakeFrameImage(FrameFormat::SPI_16, addr), MakeFrameImage(FrameFormat::SPI_24, addr),
+           MakeFrameImage(FrameFormat::SPI_32, addr)}};
+}
+
+/// Addresses of all registers defined in as5047u_registers.hpp.
+inline constexpr std::array<uint16_t, 19> REGISTER_ADDRESSES = {
+    AS5047U_REG::NOP::ADDRESS,      AS5047U_REG::ERRFL::ADDRESS,     AS5047U_REG::PROG::ADDRESS,
+    AS5047U_REG::DIA::ADDRESS,      AS5047U_REG::AGC::ADDRESS,       AS5047U_REG::SINDATA::ADDRESS,
+    AS5047U_REG::COSDATA::ADDRESS,  AS5047U_REG::VEL::ADDRESS,       AS5047U_REG::MAG::ADDRESS,
+    AS5047U_REG::ANGLEUNC::ADDRESS, AS5047U_REG::ECC_Checksum::ADDRESS,
+    AS5047U_REG::ANGLECOM::ADDRESS, AS5047U_REG::DISABLE::ADDRESS,   AS5047U_REG::ZPOSM::ADDRESS,
+    AS5047U_REG::ZPOSL::ADDRESS,    AS5047U_REG::SETTINGS1::ADDRESS, AS5047U_REG::SETTINGS2::ADDRESS,
+    AS5047U_REG::SETTINGS3::ADDRESS, AS5047U_REG::ECC::ADDRESS};
+
+namespace detail {
+
+inline constexpr uint8_t NO_COMMAND_FRAME = 0xFF;
+
+/// Registers live at 0x0000-0x001F or 0x3FC0-0x3FFF: bit 13 plus address bits 4:0 index them.
+constexpr std::size_t commandFrameSlot(uint16_t address) noexcept {
+  return ((address >> 8) & 0x20U) | (address & 0x1FU);
+}
+
+constexpr std::array<CommandFrameSet, REGISTER_ADDRESSES.size()> makeCommandFrames() noexcept {
+  std::array<CommandFrameSet, REGISTER_ADDRESSES.size()> frames{};
+  for (std::size_t i = 0; i < REGISTER_ADDRESSES.size(); ++i) {
+    frames[i] = MakeCommandFrameSet(REGISTER_ADDRESSES[i]);
+  }
+  return frames;
+}
+
+constexpr std::array<uint8_t, 64> makeCommandFrameSlots() noexcept {
+  std::array<uint8_t, 64> slots{};
+  for (auto& s : slots) {
+    s = NO_COMMAND_FRAME;
+  }
+  for (std::size_t i = 0; i < REGISTER_ADDRESSES.size(); ++i) {
+    slots[commandFrameSlot(REGISTER_ADDRESSES[i])] = static_cast<uint8_t>(i);
+  }
+  return slots;
+}
+
+constexpr bool commandFrameSlotsUnique() noexcept {
+  for (std::size_t i = 0; i < REGISTER_ADDRESSES.size(); ++i) {
+    for (std::size_t j = i + 1; j < REGISTER_ADDRESSES.size(); ++j) {
+      if (commandFrameSlot(REGISTER_ADDRESSES[i]) == commandFrameSlot(REGISTER_ADDRESSES[j])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace detail
+
+static_assert(detail::commandFrameSlotsUnique(),
+              "Two register addresses share a command frame slot; widen commandFrameSlot()");
+
+/// ROM command images, one entry per register in REGISTER_ADDRESSES order.
+inline constexpr std::array<CommandFrameSet, REGISTER_ADDRESSES.size()> COMMAND_FRAMES =
+    detail::makeCommandFrames();
+
+/// Maps detail::commandFrameSlot(address) to an index into COMMAND_FRAMES.
+inline constexpr std::array<uint8_t, 64> COMMAND_FRAME_SLOTS = detail::makeCommandFrameSlots();
+
+/**
+ * @brief Look up the ROM command images of a register address.
+ * @return Pointer into COMMAND_FRAMES, or nullptr if @p address is not a known register.
+ */
+constexpr const CommandFrameSet* FindCommandFrames(uint16_t address) noexcept {
+  const auto addr = static_cast<uint16_t>(address & 0x3FFF);
+  const uint8_t index = COMMAND_FRAME_SLOTS[detail::commandFrameSlot(addr)];
+  if (index == detail::NO_COMMAND_FRAME || COMMAND_FRAMES[index].address != addr) {
+    return nullptr;
+  }
+  return &COMMAND_FRAMES[index];
+}
+
+/// ROM command images of register type RegT (compile error if RegT is not in REGISTER_ADDRESSES).
+template <typename RegT>
+inline constexpr const CommandFrameSet& COMMAND_FRAMES_OF = *FindCommandFrames(RegT::ADDRESS);
+
+} // namespace as5047u
@@ -0,0 +1,159 @@
+/**
+ * @file as5047u_log.hpp
+ * @brief Compile-time log policies for AS5047U driver diagnostics
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ *
+ * The driver reports diagnostics (e.g. a write that did not read back) as a
+ * small POD record handed to LogPolicy::Log(). The policy is a template
+ * argument of AS5047U, so the default NullLog compiles to nothing, and no
+ * formatting or I/O ever happens on the driver's call path unless a policy
+ * chooses to do it there (PrintfLog). RingBufferLog stores the records in a
+ * lock-free ring that another task drains and formats later.
+ */
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace as5047u {
+
+/** @brief Kind of driver diagnostic. */
+enum class LogEvent : uint8_t {
+  WriteVerifyFailed,   ///< immediate read-back mismatch; errfl holds the ERRFL read afterwards
+  DeferredVerifyFailed ///< VerifyPendingWrites() mismatch; errfl is 0
+};
+
+/** @brief One driver diagnostic, recorded without formatting. */
+struct LogRecord {
+  LogEvent event;    ///< what happened
+  uint16_t address;  ///< register address
+  uint16_t expected; ///< value written
+  uint16_t actual;   ///< value read back
+  uint16_t errfl;    ///< ERRFL content fetched for the event (0 if none)
+};
+
+/// A log policy is a type with a static Log(const LogRecord&) that must not block.
+template <typename L>
+concept DriverLog = requires(const LogRecord& record) { L::Log(record); };
+
+/**
+ * @brief Format a record as one line of text (no trailing newline).
+ * @return Result of snprintf (characters that the full line needs).
+ */
+inline int FormatLogRecord(const LogRecord& record, char* buffer, std::size_t size) noexcept {
+  if (record.event == LogEvent::DeferredVerifyFailed) {
+    return std::snprintf(buffer, size,
+                         "AS5047U deferred write verify failed: addr=0x%04X expected=0x%04X "
+                         "read_back=0x%04X",
+                         static_cast<unsigned>(record.address),
+                         static_cast<unsigned>(record.expected),
+                         static_cast<unsigned>(record.actual));
+  }
+  return std::snprintf(buffer, size,
+                       "AS5047U write verify failed: addr=0x%04X expected=0x%04X read_back=0x%04X "
+                       "ERRFL=0x%04X (CRC_error=%u Framing_error=%u Command_error=%u)",
+                       static_cast<unsigned>(record.address), static_cast<unsigned>(record.expected),
+                       static_cast<unsigned>(record.actual), static_cast<unsigned>(record.errfl),
+                       static_cast<unsigned>((record.errfl >> 6) & 1U),
+                       static_cast<unsigned>((record.errfl >> 4) & 1U),
+                       static_cast<unsigned>((record.errfl >> 5) & 1U));
+}
+
+/** @brief Default policy: diagnostics are discarded (failures still set sticky error flags). */
+struct NullLog {
+  static void Log(const LogRecord& /*record*/) noexcept {}
+};
+
+/** @brief Print each record immediately with printf (blocking; for bring-up only). */
+struct PrintfLog {
+  static void Log(const LogRecord& record) noexcept {
+    char line[160];
+    FormatLogRecord(record, line, sizeof(line));
+    std::printf("%s\n", line);
+  }
+};
+
+/**
+ * @brief Lock-free ring of log records, drained and formatted outside the real-time path.
+ *
+ * Log() copies the 10-byte record into a slot and publishes it with one release
+ * store; when the ring is full the record is counted as dropped instead of
+ * waiting. Pop()/Drain() run in a low-priority task that formats the records
+ * (FormatLogRecord()) and does the I/O.
+ *
+ * The ring is single-producer / single-consumer: all drivers using one
+ * instantiation must log from one execution context. Use a distinct Tag to get
+ * a separate ring per context.
+ *
+ * @tparam Capacity Number of slots (power of two)
+ * @tparam Tag      Distinguishes independent rings of the same capacity
+ *
+ * @code
+ * using EncoderLog = as5047u::RingBufferLog<32>;
+ * as5047u::AS5047U<MyBus, as5047u::RuntimeFrameFormat{}, EncoderLog> encoder(bus);
+ * // logger task:
+ * EncoderLog::Drain([](const as5047u::LogRecord& r) {
+ *   char line[160];
+ *   as5047u::FormatLogRecord(r, line, sizeof(line));
+ *   puts(line);
+ * });
+ * @endcode
+ */
+template <std::size_t Capacity = 32, typename Tag = void>
+class RingBufferLog {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "RingBufferLog capacity must be a power of two");
+
+public:
+  /** @brief Producer side: enqueue a record, or count it as dropped if the ring is full. */
+  static void Log(const LogRecord& record) noexcept {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) == Capacity) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    slots_[head & (Capacity - 1)] = record;
+    head_.store(head + 1, std::memory_order_release);
+  }
+
+  /** @brief Consumer side: take the oldest record. @return false if the ring is empty. */
+  static bool Pop(LogRecord& out) noexcept {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    out = slots_[tail & (Capacity - 1)];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Consumer side: pop every queued record into sink(const LogRecord&).
+   * @return Number of records handed to the sink.
+   */
+  template <typename Sink>
+  static std::size_t Drain(Sink&& sink) {
+    std::size_t count = 0;
+    LogRecord record{};
+    while (Pop(record)) {
+      sink(record);
+      ++count;
+    }
+    return count;
+  }
+
+  /** @brief Records lost to a full ring since the last call (resets the counter). */
+  static uint32_t TakeDropped() noexcept {
+    return dropped_.exchange(0, std::memory_order_relaxed);
+  }
+
+private:
+  static inline std::array<LogRecord, Capacity> slots_{};
+  static inline std::atomic<std::size_t> head_{0};
+  static inline std::atomic<std::size_t> tail_{0};
+  static inline std::atomic<uint32_t> dropped_{0};
+};
+
+} // namespace as5047u
@@ -0,0 +1,211 @@
+/**
+ * @file as5047u_multiturn.hpp
+ * @brief Multi-turn position accumulator over single-turn 14-bit angle samples
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ *
+ * The AS5047U reports one turn (0-16383). MultiTurnCounter turns a stream of
+ * angle samples into a 64-bit position in LSB counts (16384 per turn) that
+ * overflows after about 5.6e14 turns.
+ *
+ * The step between two samples is the 14-bit difference sign-extended, i.e.
+ * the shortest way round the circle: 0x3FFF -> 0 is +1, 0 -> 0x3FFF is -1. This
+ * is unambiguous while the shaft moves less than half a turn per sample. A
+ * tighter velocity bound (max_step, LSB per sample) can be set so that a step
+ * larger than the mechanics allow is rejected as a glitch instead of being
+ * counted. A glitch is a single bad sample; if resync_after samples in a row
+ * are rejected the move was real, and the next one is counted from the last
+ * accepted angle so the counter follows the shaft again.
+ *
+ * Update() is branchless: a rejected step is masked out, not branched around,
+ * so a block of samples runs at a fixed cost per sample.
+ */
+#pragma once
+#include "as5047u.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace as5047u {
+
+/**
+ * @brief 64-bit multi-turn position from single-turn angle samples.
+ *
+ * @code
+ * MultiTurnCounter position;                    // any speed below half a turn per sample
+ * position.Update(encoder.GetAngle());          // per sample
+ * position.Update(std::span(block.data(), n));  // or per block from AS5047USampler::Drain()
+ * int64_t turns = position.GetTurns();
+ * @endcode
+ */
+class MultiTurnCounter {
+public:
+  static constexpr int64_t COUNTS_PER_TURN = 16384;   ///< LSB per mechanical turn
+  static constexpr uint16_t MAX_STEP_LIMIT = 0x2000; ///< half a turn, the largest step there is
+  static constexpr uint16_t DEFAULT_RESYNC = 4;      ///< rejections in a row that count as a real move
+
+  /**
+   * @param max_step     Velocity bound in LSB per sample; larger steps are rejected.
+   *                     Capped at MAX_STEP_LIMIT (the default, which rejects nothing; an
+   *                     exact half turn counts as -8192).
+   * @param resync_after Consecutive rejections after which the next sample is accepted,
+   *                     counting the whole step since the last accepted angle (at least 1).
+   */
+  explicit MultiTurnCounter(uint16_t max_step = MAX_STEP_LIMIT,
+                            uint16_t resync_after = DEFAULT_RESYNC) noexcept
+      : max_step_(max_step < MAX_STEP_LIMIT ? max_step : MAX_STEP_LIMIT),
+        resync_after_(resync_after > 0 ? resync_after : 1) {}
+
+  /**
+   * @brief Add one angle sample (ANGLECOM or ANGLEUNC LSB, 0-16383).
+   *
+   * The first sample after construction or Reset() sets the position to that
+   * angle on turn 0.
+   */
+  void Update(uint16_t angle) noexcept {
+    if (!initialized_) {
+      start(angle);
+      return;
+    }
+    step(angle & 0x3FFF, position_, last_angle_, run_, rejected_);
+  }
+
+  /** @brief Add a block of angle samples, oldest first. */
+  void Update(std::span<const uint16_t> angles) noexcept {
+    if (angles.empty()) {
+      return;
+    }
+    std::size_t first = 0;
+    if (!initialized_) {
+      start(angles[0]);
+      first = 1;
+    }
+    int64_t position = position_;
+    uint16_t last = last_angle_;
+    uint32_t run = run_;
+    uint32_t rejected = rejected_;
+    for (std::size_t i = first; i < angles.size(); ++i) {
+      step(angles[i] & 0x3FFF, position, last, run, rejected);
+    }
+    position_ = position;
+    last_angle_ = last;
+    run_ = run;
+    rejected_ = rejected;
+  }
+
+  /** @brief Add a block of sampler records; a sample with a communication error is rejected. */
+  void Update(std::span<const EncoderSample> samples) noexcept {
+    std::size_t first = 0;
+    while (!initialized_ && first < samples.size()) {
+      if (!hasCommError(samples[first])) {
+        start(samples[first].angle);
+      } else {
+        ++rejected_;
+      }
+      ++first;
+    }
+    int64_t position = position_;
+    uint16_t last = last_angle_;
+    uint32_t run = run_;
+    uint32_t rejected = rejected_;
+    for (std::size_t i = first; i < samples.size(); ++i) {
+      // A corrupted sample is replaced by the last good angle: a zero step, counted as rejected.
+      // It carries no information about a real move, so the rejection run is kept as it was.
+      const uint32_t bad = static_cast<uint32_t>(hasCommError(samples[i]));
+      const uint32_t keep = 0U - bad; // all ones for a corrupted sample
+      const auto angle = static_cast<uint16_t>((samples[i].angle & ~keep) | (last & keep));
+      const uint32_t run_before = run;
+      rejected += bad;
+      step(angle & 0x3FFF, position, last, run, rejected);
+      run = (run & ~keep) | (run_before & keep);
+    }
+    position_ = position;
+    last_angle_ = last;
+    run_ = run;
+    rejected_ = rejected;
+  }
+
+  /** @brief Add one sampler record; a sample with a communication error is rejected. */
+  void Update(const EncoderSample& sample) noexcept {
+    Update(std::span<const EncoderSample>(&sample, 1));
+  }
+
+  /** @brief Forget the position; the next sample starts again on turn 0. */
+  void Reset() noexcept {
+    position_ = 0;
+    last_angle_ = 0;
+    run_ = 0;
+    initialized_ = false;
+  }
+
+  /**
+   * @brief Re-reference the position (homing), keeping the angle tracking.
+   * @param position New position in LSB counts for the last accepted sample.
+   */
+  void SetPosition(int64_t position) noexcept {
+    position_ = position;
+  }
+
+  /** @brief Position in LSB counts (COUNTS_PER_TURN per turn). */
+  [[nodiscard]] int64_t GetPosition() const noexcept {
+    return position_;
+  }
+
+  /** @brief Whole turns, rounded toward negative infinity. */
+  [[nodiscard]] int64_t GetTurns() const noexcept {
+    return position_ >> 14; // arithmetic shift: floor division by COUNTS_PER_TURN
+  }
+
+  /** @brief Angle within the current turn, 0-16383. */
+  [[nodiscard]] uint16_t GetAngle() const noexcept {
+    return static_cast<uint16_t>(position_ & (COUNTS_PER_TURN - 1));
+  }
+
+  /** @brief Position in degrees. */
+  [[nodiscard]] double GetPositionDegrees() const noexcept {
+    return static_cast<double>(position_) * (360.0 / static_cast<double>(COUNTS_PER_TURN));
+  }
+
+  /** @brief Samples rejected by the velocity bound or a communication error (resets the counter). */
+  uint32_t TakeRejected() noexcept {
+    const uint32_t rejected = rejected_;
+    rejected_ = 0;
+    return rejected;
+  }
+
+private:
+  void start(uint16_t angle) noexcept {
+    last_angle_ = angle & 0x3FFF;
+    position_ = last_angle_;
+    initialized_ = true;
+  }
+
+  static bool hasCommError(const EncoderSample& sample) noexcept {
+    return (static_cast<uint16_t>(sample.errors) & COMM_ERROR_MASK) != 0U;
+  }
+
+  /// One sample: shortest signed 14-bit step, masked out if it exceeds the velocity bound
+  /// unless the last resync_after_ samples were all rejected too.
+  void step(uint16_t angle, int64_t& position, uint16_t& last, uint32_t& run,
+            uint32_t& rejected) const noexcept {
+    // Shift the 14-bit difference to the top of 32 bits and back: sign extension handles the wrap
+    const int32_t delta =
+        static_cast<int32_t>(static_cast<uint32_t>(angle - last) << 18U) >> 18U;
+    const int32_t magnitude = delta < 0 ? -delta : delta;
+    const int32_t accept = static_cast<int32_t>(magnitude <= static_cast<int32_t>(max_step_)) |
+                           static_cast<int32_t>(run >= resync_after_);
+    position += delta & -accept;
+    last = static_cast<uint16_t>(last ^ ((last ^ angle) & -accept));
+    run = (run + 1U) & static_cast<uint32_t>(accept - 1); // 0 after an accepted step
+    rejected += static_cast<uint32_t>(1 - accept);
+  }
+
+  int64_t position_{0};
+  uint16_t last_angle_{0}; ///< last accepted angle
+  uint16_t max_step_;      ///< velocity bound, LSB per sample
+  uint16_t resync_after_;  ///< rejections in a row after which a step is accepted
+  uint32_t run_{0};        ///< current run of rejected steps
+  uint32_t rejected_{0};
+  bool initialized_{false};
+};
+
+} // namespace as5047u
@@ -0,0 +1,289 @@
+/**
+ * @file as5047u_observer.hpp
+ * @brief Angle tracking observer: low-latency velocity from ANGLECOM samples
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ *
+ * The VEL register is quantized at AS5047U::Velocity::DEG_PER_LSB (24.141 deg/s)
+ * and delayed by the sensor's velocity filter (SetFilterPreset()). A second-order
+ * tracking loop (type-2 PLL) run on the angle samples the application already
+ * reads gives a finer, lower-latency velocity at the loop rate without extra SPI
+ * frames:
+ *
+ *   predicted = angle + velocity * T
+ *   error     = wrap(measured - predicted)     (shortest way round the circle)
+ *   angle     = predicted + Kp * error          Kp = 2 * zeta * wn * T
+ *   velocity  = velocity + Ki * error / T       Ki = (wn * T)^2
+ *
+ * wn = 2 * pi * bandwidth. The loop tracks a constant speed with zero steady-state
+ * error. Keep the bandwidth well below the sample rate (about rate / 10 or less).
+ * Both variants update in O(1) per sample:
+ *
+ * | Class              | State                              | Update path  |
+ * |--------------------|------------------------------------|--------------|
+ * | VelocityObserver   | float angle (LSB) and LSB/sample   | float        |
+ * | VelocityObserverQ  | uint32 phase (2^32 per turn), Q30  | integer only |
+ */
+#pragma once
+#include "as5047u.hpp"
+#include <cmath>
+#include <cstdint>
+#include <span>
+
+namespace as5047u {
+
+/// Damping ratio used when none is given.
+inline constexpr float OBSERVER_DEFAULT_DAMPING = 0.707F;
+
+/// Loop gains of the tracking observer for one sample period.
+struct ObserverGains {
+  float kp{0.0F}; ///< position correction per unit error (2 * zeta * wn * T)
+  float ki{0.0F}; ///< velocity correction per unit error and sample ((wn * T)^2)
+
+  /**
+   * @param sample_rate_hz Rate at which Update() is called.
+   * @param bandwidth_hz   Loop natural frequency.
+   * @param damping        Damping ratio (0.707 by default, 1.0 for no overshoot).
+   */
+  [[nodiscard]] static ObserverGains Compute(float sample_rate_hz, float bandwidth_hz,
+                                             float damping = OBSERVER_DEFAULT_DAMPING) noexcept {
+    const float wn_t = 2.0F * static_cast<float>(M_PI) * bandwidth_hz / sample_rate_hz;
+    return {2.0F * damping * wn_t, wn_t * wn_t};
+  }
+};
+
+namespace detail {
+/// Angle LSB per second -> `unit`; VelocityUnit::Lsb is the VEL register LSB (24.141 deg/s).
+inline float ObserverVelocity(float lsb_per_sec, VelocityUnit unit) noexcept {
+  const float deg_per_sec = lsb_per_sec * (360.0F / 16384.0F);
+  switch (unit) {
+    case VelocityUnit::Lsb:
+      return deg_per_sec / 24.141F; // AS5047U::Velocity::DEG_PER_LSB
+    case VelocityUnit::RadPerSec:
+      return deg_per_sec * (static_cast<float>(M_PI) / 180.0F);
+    case VelocityUnit::Rpm:
+      return deg_per_sec * (60.0F / 360.0F);
+    case VelocityUnit::DegPerSec:
+    default:
+      return deg_per_sec;
+  }
+}
+} // namespace detail
+
+/**
+ * @brief Angle tracking observer in float.
+ *
+ * Feed it one ANGLECOM value (0-16383) per sample period. The first sample
+ * initializes the angle; samples with a communication error only advance the
+ * prediction.
+ *
+ * @code
+ * VelocityObserver observer(20000.0F, 500.0F); // 20 kHz loop, 500 Hz bandwidth
+ * observer.Update(encoder.GetAngle());
+ * float rpm = observer.GetVelocity(VelocityUnit::Rpm);
+ * @endcode
+ */
+class VelocityObserver {
+public:
+  /**
+   * @param sample_rate_hz Rate at which Update() is called.
+   * @param bandwidth_hz   Loop bandwidth; higher follows acceleration faster, lower is smoother.
+   * @param damping        Damping ratio.
+   */
+  VelocityObserver(float sample_rate_hz, float bandwidth_hz,
+                   float damping = OBSERVER_DEFAULT_DAMPING) noexcept
+      : gains_(ObserverGains::Compute(sample_rate_hz, bandwidth_hz, damping)),
+        sample_rate_hz_(sample_rate_hz) {}
+
+  /** @brief Correct the estimate with one angle sample (ANGLECOM LSB, 0-16383). */
+  void Update(uint16_t angle) noexcept {
+    const auto measured = static_cast<float>(angle & 0x3FFF);
+    if (!initialized_) {
+      angle_ = measured;
+      initialized_ = true;
+      return;
+    }
+    const float predicted = wrap(angle_ + velocity_);
+    const float error = fold(measured - predicted);
+    angle_ = wrap(predicted + (gains_.kp * error));
+    velocity_ += gains_.ki * error;
+  }
+
+  /** @brief Update from a sampler record; a sample with a communication error only predicts. */
+  void Update(const EncoderSample& sample) noexcept {
+    if ((static_cast<uint16_t>(sample.errors) & COMM_ERROR_MASK) != 0U) {
+      Predict();
+      return;
+    }
+    Update(sample.angle);
+  }
+
+  /** @brief Update from a block of samples, e.g. the output of AS5047USampler::Drain(). */
+  void Update(std::span<const EncoderSample> samples) noexcept {
+    for (const EncoderSample& sample : samples) {
+      Update(sample);
+    }
+  }
+
+  /** @brief Advance one period without a measurement (missed or corrupted sample). */
+  void Predict() noexcept {
+    angle_ = wrap(angle_ + velocity_);
+  }
+
+  /** @brief Forget the state; the next sample re-initializes the angle. */
+  void Reset() noexcept {
+    angle_ = 0.0F;
+    velocity_ = 0.0F;
+    initialized_ = false;
+  }
+
+  /** @brief Estimated angle in LSB, [0, 16384). */
+  [[nodiscard]] float GetAngle() const noexcept {
+    return angle_;
+  }
+
+  /**
+   * @brief Estimated velocity.
+   * @param unit VelocityUnit::Lsb is the VEL register LSB (24.141 deg/s), as in AS5047U::GetVelocity().
+   */
+  [[nodiscard]] float GetVelocity(VelocityUnit unit = VelocityUnit::DegPerSec) const noexcept {
+    return detail::ObserverVelocity(velocity_ * sample_rate_hz_, unit);
+  }
+
+private:
+  static constexpr float TURN = 16384.0F;
+
+  /// [0, TURN) for values less than one turn outside it.
+  static float wrap(float angle) noexcept {
+    if (angle >= TURN) {
+      return angle - TURN;
+    }
+    return angle < 0.0F ? angle + TURN : angle;
+  }
+  /// Difference of two angles as the shortest signed distance, [-TURN/2, TURN/2).
+  static float fold(float delta) noexcept {
+    if (delta >= TURN / 2.0F) {
+      return delta - TURN;
+    }
+    return delta < -TURN / 2.0F ? delta + TURN : delta;
+  }
+
+  ObserverGains gains_;
+  float sample_rate_hz_;
+  float angle_{0.0F};    ///< LSB
+  float velocity_{0.0F}; ///< LSB per sample
+  bool initialized_{false};
+};
+
+/**
+ * @brief Angle tracking observer in fixed point for cores without an FPU.
+ *
+ * The angle is a 32-bit phase (2^32 per turn, ANGLECOM << 18), so wrap-around
+ * is ordinary unsigned overflow and the signed error is a single subtraction.
+ * Gains are Q30 and products are 64-bit; Update() has no floating point and no
+ * branch after the first sample. Only the constructor and the float getters
+ * use floating point.
+ */
+class VelocityObserverQ {
+public:
+  /**
+   * @param sample_rate_hz Rate at which Update() is called.
+   * @param bandwidth_hz   Loop bandwidth.
+   * @param damping        Damping ratio.
+   */
+  VelocityObserverQ(float sample_rate_hz, float bandwidth_hz,
+                    float damping = OBSERVER_DEFAULT_DAMPING) noexcept
+      : sample_rate_hz_(sample_rate_hz), sample_rate_int_(std::lround(sample_rate_hz)) {
+    const ObserverGains gains = ObserverGains::Compute(sample_rate_hz, bandwidth_hz, damping);
+    kp_q30_ = toQ30(gains.kp);
+    ki_q30_ = toQ30(gains.ki);
+  }
+
+  /** @brief Correct the estimate with one angle sample (ANGLECOM LSB, 0-16383). */
+  void Update(uint16_t angle) noexcept {
+    const uint32_t measured = static_cast<uint32_t>(angle & 0x3FFF) << PHASE_SHIFT;
+    if (!initialized_) {
+      phase_ = measured;
+      initialized_ = true;
+      return;
+    }
+    const uint32_t predicted = phase_ + static_cast<uint32_t>(velocity_);
+    const auto error = static_cast<int32_t>(measured - predicted);
+    phase_ = predicted + static_cast<uint32_t>((static_cast<int64_t>(kp_q30_) * error) >> 30);
+    velocity_ += static_cast<int32_t>((static_cast<int64_t>(ki_q30_) * error) >> 30);
+  }
+
+  /** @brief Update from a sampler record; a sample with a communication error only predicts. */
+  void Update(const EncoderSample& sample) noexcept {
+    if ((static_cast<uint16_t>(sample.errors) & COMM_ERROR_MASK) != 0U) {
+      Predict();
+      return;
+    }
+    Update(sample.angle);
+  }
+
+  /** @brief Update from a block of samples, e.g. the output of AS5047USampler::Drain(). */
+  void Update(std::span<const EncoderSample> samples) noexcept {
+    for (const EncoderSample& sample : samples) {
+      Update(sample);
+    }
+  }
+
+  /** @brief Advance one period without a measurement (missed or corrupted sample). */
+  void Predict() noexcept {
+    phase_ += static_cast<uint32_t>(velocity_);
+  }
+
+  /** @brief Forget the state; the next sample re-initializes the angle. */
+  void Reset() noexcept {
+    phase_ = 0;
+    velocity_ = 0;
+    initialized_ = false;
+  }
+
+  /** @brief Estimated angle as a 32-bit phase (2^32 per turn). */
+  [[nodiscard]] uint32_t GetPhase() const noexcept {
+    return phase_;
+  }
+
+  /** @brief Estimated angle in LSB (0-16383), rounded. */
+  [[nodiscard]] uint16_t GetAngle() const noexcept {
+    return static_cast<uint16_t>(((phase_ + (1U << (PHASE_SHIFT - 1U))) >> PHASE_SHIFT) & 0x3FFF);
+  }
+
+  /** @brief Estimated velocity in phase units per sample (2^32 = one turn per sample). */
+  [[nodiscard]] int32_t GetVelocityPhase() const noexcept {
+    return velocity_;
+  }
+
+  /** @brief Estimated velocity in angle LSB per second, integer math only. */
+  [[nodiscard]] int32_t GetVelocityLsbPerSec() const noexcept {
+    return static_cast<int32_t>((static_cast<int64_t>(velocity_) * sample_rate_int_) >> PHASE_SHIFT);
+  }
+
+  /** @brief Estimated velocity; VelocityUnit::Lsb is the VEL register LSB (24.141 deg/s). */
+  [[nodiscard]] float GetVelocity(VelocityUnit unit = VelocityUnit::DegPerSec) const noexcept {
+    constexpr float LSB_PER_PHASE = 1.0F / static_cast<float>(1U << PHASE_SHIFT);
+    return detail::ObserverVelocity(static_cast<float>(velocity_) * LSB_PER_PHASE * sample_rate_hz_,
+                                    unit);
+  }
+
+private:
+  static constexpr uint32_t PHASE_SHIFT = 18; ///< 14-bit angle -> 32-bit phase
+
+  /// Q30 gain, saturated just below 2.0 (larger gains are unstable anyway).
+  static int32_t toQ30(float gain) noexcept {
+    constexpr float MAX_GAIN = 1.999F;
+    const float clamped = gain < MAX_GAIN ? gain : MAX_GAIN;
+    return static_cast<int32_t>(std::lround(static_cast<double>(clamped) * (1 << 30)));
+  }
+
+  float sample_rate_hz_;
+  int64_t sample_rate_int_; ///< rounded, for the integer velocity
+  int32_t kp_q30_{0};
+  int32_t ki_q30_{0};
+  uint32_t phase_{0};   ///< 2^32 per turn
+  int32_t velocity_{0}; ///< phase units per sample
+  bool initialized_{false};
+};
+
+} // namespace as5047u
@@ -0,0 +1,228 @@
+/**
+ * @file as5047u_sampler.hpp
+ * @brief Fixed-rate background sampler feeding a lock-free SPSC ring of timestamped samples
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ */
+#pragma once
+#include "as5047u.hpp"
+#include "as5047u_snapshot.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+
+namespace as5047u {
+
+/**
+ * @brief Preallocated lock-free single-producer / single-consumer ring.
+ *
+ * Push() never blocks: when the ring is full the new element is counted as
+ * dropped. Drain() copies a block of elements and releases them with a single
+ * store, so a consumer can take everything queued in one call.
+ *
+ * @tparam T        Trivially copyable element type
+ * @tparam Capacity Number of slots (power of two)
+ */
+template <typename T, std::size_t Capacity>
+class SpscRing {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "SpscRing capacity must be a power of two");
+
+public:
+  /** @brief Producer side: append an element. @return false (and count a drop) if full. */
+  bool Push(const T& value) noexcept {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) == Capacity) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    slots_[head & (Capacity - 1)] = value;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /** @brief Consumer side: take the oldest element. @return false if the ring is empty. */
+  bool Pop(T& out) noexcept {
+    return Drain(std::span<T>(&out, 1)) == 1U;
+  }
+
+  /**
+   * @brief Consumer side: take up to out.size() elements, oldest first.
+   * @return Number of elements copied.
+   */
+  std::size_t Drain(std::span<T> out) noexcept {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    const std::size_t available = head_.load(std::memory_order_acquire) - tail;
+    const std::size_t count = available < out.size() ? available : out.size();
+    for (std::size_t i = 0; i < count; ++i) {
+      out[i] = slots_[(tail + i) & (Capacity - 1)];
+    }
+    tail_.store(tail + count, std::memory_order_release);
+    return count;
+  }
+
+  /** @brief Elements currently queued (exact for the consumer, a snapshot for others). */
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+  }
+
+  /** @brief Elements lost to a full ring since the last call (resets the counter). */
+  uint32_t TakeDropped() noexcept {
+    return dropped_.exchange(0, std::memory_order_relaxed);
+  }
+
+  static constexpr std::size_t CAPACITY = Capacity; ///< number of slots
+
+private:
+  std::array<T, Capacity> slots_{};
+  alignas(64) std::atomic<std::size_t> head_{0}; ///< written by the producer only
+  alignas(64) std::atomic<std::size_t> tail_{0}; ///< written by the consumer only
+  std::atomic<uint32_t> dropped_{0};
+};
+
+/**
+ * @brief Samples one AS5047U at a fixed rate and queues timestamped EncoderSample records.
+ *
+ * Start() launches a std::thread that calls AS5047U::ReadSample() on an absolute
+ * schedule: each deadline is the previous deadline plus the period, and the thread
+ * sleeps with sleep_until(). Jitter therefore does not accumulate. When an acquisition
+ * overruns one or more deadlines, the missed deadlines are skipped and counted, not
+ * sent back to back. Each sample is pushed into a preallocated SpscRing, and
+ * optionally published to a SampleSnapshot. Consumers drain blocks of samples
+ * without touching the bus.
+ *
+ * While the sampler runs it owns the driver. Other threads must not use the same
+ * driver unless its concurrency policy locks the bus (Locked / SpinLocked).
+ *
+ * Without Start(), Step() takes one sample on demand, for example from an RTOS
+ * timer task.
+ *
+ * @tparam Driver   AS5047U instantiation
+ * @tparam Capacity Ring slots (power of two)
+ *
+ * @code
+ * AS5047USampler<decltype(encoder)> sampler(encoder, std::chrono::microseconds(500)); // 2 kHz
+ * sampler.Start();
+ * std::array<EncoderSample, 64> block{};
+ * std::size_t n = sampler.Drain(block);   // consumer thread
+ * @endcode
+ */
+template <typename Driver, std::size_t Capacity = 256>
+class AS5047USampler {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Construct a stopped sampler.
+   * @param driver Encoder to sample.
+   * @param period Sampling period (must be non-zero to Start()).
+   */
+  AS5047USampler(const Driver& driver, std::chrono::microseconds period) noexcept;
+
+  /** @brief Stops the sampling thread if it is running. */
+  ~AS5047USampler();
+
+  AS5047USampler(const AS5047USampler&) = delete;
+  AS5047USampler& operator=(const AS5047USampler&) = delete;
+
+  /**
+   * @brief Start the sampling thread.
+   * @return false if it is already running or the period is zero.
+   */
+  bool Start();
+
+  /** @brief Stop the sampling thread and wait for it to exit (no-op if stopped). */
+  void Stop();
+
+  /** @brief true while the sampling thread runs. */
+  [[nodiscard]] bool IsRunning() const noexcept {
+    return running_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Change the sampling period.
+   * @return false if the sampler is running (the period is fixed while it runs).
+   */
+  bool SetPeriod(std::chrono::microseconds period) noexcept;
+
+  /** @brief Current sampling period. */
+  [[nodiscard]] std::chrono::microseconds GetPeriod() const noexcept {
+    return period_;
+  }
+
+  /**
+   * @brief Also publish every sample to a snapshot for latest-value readers.
+   * @param snapshot Snapshot to publish to, or nullptr to stop publishing. Set it before Start().
+   */
+  void SetSnapshot(SampleSnapshot* snapshot) noexcept {
+    snapshot_ = snapshot;
+  }
+
+  /**
+   * @brief Take one sample now, queue it (and publish it), and return it.
+   *
+   * The sampling thread calls this once per period; call it directly only while
+   * the sampler is stopped.
+   */
+  EncoderSample Step();
+
+  /**
+   * @brief Consumer side: take up to out.size() queued samples, oldest first.
+   * @return Number of samples copied.
+   */
+  std::size_t Drain(std::span<EncoderSample> out) noexcept {
+    return ring_.Drain(out);
+  }
+
+  /** @brief Consumer side: take the oldest queued sample. @return false if none is queued. */
+  bool Pop(EncoderSample& out) noexcept {
+    return ring_.Pop(out);
+  }
+
+  /** @brief Samples currently queued. */
+  [[nodiscard]] std::size_t Pending() const noexcept {
+    return ring_.Size();
+  }
+
+  /** @brief Samples lost to a full ring since the last call (resets the counter). */
+  uint32_t TakeDropped() noexcept {
+    return ring_.TakeDropped();
+  }
+
+  /** @brief Deadlines skipped because an acquisition ran late (resets the counter). */
+  uint32_t TakeOverruns() noexcept {
+    return overruns_.exchange(0, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Microseconds on Clock, the time base of EncoderSample::timestamp when the driver
+   * has no clock policy (NullClock). Otherwise samples carry the driver's command-frame ticks.
+   */
+  static uint64_t NowMicros() noexcept {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch())
+            .count());
+  }
+
+private:
+  void run();
+
+  const Driver& driver_;
+  std::chrono::microseconds period_;
+  SampleSnapshot* snapshot_{nullptr};
+  SpscRing<EncoderSample, Capacity> ring_{};
+  std::atomic<bool> running_{false};
+  std::atomic<uint32_t> overruns_{0};
+  std::thread thread_;
+};
+
+} // namespace as5047u
+
+// Include template implementation
+#define AS5047U_SAMPLER_HEADER_INCLUDED
+// NOLINTNEXTLINE(bugprone-suspicious-include) - Intentional: template implementation file
+#include "../src/as5047u_sampler.ipp"
+#undef AS5047U_SAMPLER_HEADER_INCLUDED
@@ -0,0 +1,134 @@
+/**
+ * @file as5047u_snapshot.hpp
+ * @brief Seqlock-published latest encoder sample for many concurrent readers
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ */
+#pragma once
+#include "as5047u.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace as5047u {
+
+/**
+ * @brief Latest EncoderSample, written by one acquisition thread and read lock-free by any number
+ * of consumers.
+ *
+ * The acquisition thread owns the driver and calls Update() (or Publish()) once per
+ * period. Consumers such as control, telemetry or a safety monitor call Load() and get a
+ * torn-free copy without touching the SPI bus or taking a lock. The writer never waits.
+ *
+ * Seqlock: the sequence counter is odd while a publish is in progress. A reader copies the
+ * sample between two reads of the counter and retries if the counter was odd or changed.
+ * The sample is stored as relaxed atomic words, so a racing copy is never undefined
+ * behaviour, only discarded.
+ *
+ * @code
+ * SampleSnapshot latest;
+ * // acquisition thread:
+ * latest.Update(encoder); // or Update(encoder, now_us()) without a clock policy
+ * // any consumer:
+ * EncoderSample s = latest.Load();
+ * @endcode
+ */
+class SampleSnapshot {
+public:
+  /**
+   * @brief Writer side: publish a new sample (single writer only).
+   * @param sample The sample to expose to readers.
+   */
+  void Publish(const EncoderSample& sample) noexcept {
+    const auto words = std::bit_cast<std::array<uint32_t, WORDS>>(sample);
+    const uint32_t seq = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(seq + 1U, std::memory_order_relaxed); // odd: publish in progress
+    std::atomic_thread_fence(std::memory_order_release);
+    for (std::size_t i = 0; i < WORDS; ++i) {
+      words_[i].store(words[i], std::memory_order_relaxed);
+    }
+    sequence_.store(seq + 2U, std::memory_order_release);
+  }
+
+  /**
+   * @brief Writer side: take one sample from the driver and publish it.
+   *
+   * The sample keeps the timestamp of the driver's clock policy.
+   * @param driver Encoder owned by the calling thread.
+   * @return The published sample.
+   */
+  template <typename Driver>
+  EncoderSample Update(const Driver& driver) {
+    const EncoderSample sample = driver.ReadSample();
+    Publish(sample);
+    return sample;
+  }
+
+  /**
+   * @brief Writer side: take one sample, stamp it with the caller's time and publish it.
+   * @param driver    Encoder owned by the calling thread.
+   * @param timestamp Capture time stored in the sample, replacing the driver's.
+   * @return The published sample.
+   */
+  template <typename Driver>
+  EncoderSample Update(const Driver& driver, uint64_t timestamp) {
+    EncoderSample sample = driver.ReadSample();
+    sample.timestamp = timestamp;
+    Publish(sample);
+    return sample;
+  }
+
+  /**
+   * @brief Reader side: copy the latest sample if no publish overlaps the copy.
+   * @param out Receives the sample on success.
+   * @return false if a publish was in progress (the caller may retry).
+   */
+  [[nodiscard]] bool TryLoad(EncoderSample& out) const noexcept {
+    const uint32_t before = sequence_.load(std::memory_order_acquire);
+    if ((before & 1U) != 0U) {
+      return false;
+    }
+    std::array<uint32_t, WORDS> words{};
+    for (std::size_t i = 0; i < WORDS; ++i) {
+      words[i] = words_[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence_.load(std::memory_order_relaxed) != before) {
+      return false;
+    }
+    out = std::bit_cast<EncoderSample>(words);
+    return true;
+  }
+
+  /**
+   * @brief Reader side: copy the latest sample, retrying while a publish overlaps.
+   *
+   * A publish takes a few stores, so the loop runs more than once only when the
+   * reader is preempted in the middle of its copy or races a publish.
+   * @return The latest sample (all fields zero before the first publish).
+   */
+  [[nodiscard]] EncoderSample Load() const noexcept {
+    EncoderSample sample{};
+    while (!TryLoad(sample)) {
+    }
+    return sample;
+  }
+
+  /** @brief Number of samples published so far (readers can detect a stalled writer). */
+  [[nodiscard]] uint32_t PublishCount() const noexcept {
+    return sequence_.load(std::memory_order_acquire) / 2U;
+  }
+
+private:
+  static_assert(std::is_trivially_copyable_v<EncoderSample>, "EncoderSample is stored bytewise");
+  static_assert(sizeof(EncoderSample) % sizeof(uint32_t) == 0U,
+                "EncoderSample is stored as whole 32-bit words");
+  static constexpr std::size_t WORDS = sizeof(EncoderSample) / sizeof(uint32_t);
+
+  std::atomic<uint32_t> sequence_{0};                ///< odd while a publish is in progress
+  std::array<std::atomic<uint32_t>, WORDS> words_{}; ///< sample bytes
+};
+
+} // namespace as5047u
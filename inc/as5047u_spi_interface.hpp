@@ -4,9 +4,17 @@
  * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
  */
 #pragma once
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
 
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define AS5047U_HAS_COROUTINES 1
+#else
+#define AS5047U_HAS_COROUTINES 0
+#endif
+
 namespace as5047u {
 
 /**
@@ -31,6 +39,42 @@ namespace as5047u {
  * };
  * @endcode
  *
+ * Optional frame-list extension: a bus may additionally provide
+ * @code
+ *   void transfer_frames(const uint8_t *tx, uint8_t *rx, std::size_t frame_len,
+ *                        std::size_t frame_count);
+ * @endcode
+ * which clocks `frame_count` back-to-back frames of `frame_len` bytes each
+ * (stored contiguously in `tx`/`rx`), toggling chip select between frames.
+ * This lets an implementation submit a whole command/NOP sequence as a single
+ * DMA descriptor chain or `SPI_IOC_MESSAGE(n)`. The driver detects the hook at
+ * compile time (SupportsFrameListTransfer) and otherwise falls back to one
+ * transfer() call per frame.
+ *
+ * Optional asynchronous extension: a bus may provide
+ * @code
+ *   bool begin_transfer(const uint8_t *tx, uint8_t *rx, std::size_t frame_len,
+ *                       std::size_t frame_count);
+ *   bool is_done();
+ * @endcode
+ * begin_transfer() starts the same frame list as transfer_frames() but returns
+ * immediately (e.g. after arming DMA); is_done() reports completion, typically
+ * from a flag set in the DMA/IRQ handler. `tx` and `rx` stay owned by the
+ * driver and remain valid until is_done() returns true. Buses providing both
+ * (SupportsAsyncTransfer) unlock the driver's StartAsyncRead()/
+ * CompleteAsyncRead() API.
+ *
+ * Optional coroutine extension: on top of the asynchronous hooks, a bus may
+ * provide
+ * @code
+ *   void resume_when_done(std::coroutine_handle<> handle);
+ * @endcode
+ * which arranges for `handle` to be resumed by the bus's executor once the
+ * transfer started by begin_transfer() has completed (immediately, if it
+ * already has). Buses providing it (SupportsCoroutineResume) unlock the
+ * driver's co_await-able AwaitAngle()/AwaitVelocity()/AwaitReadReg()/
+ * AwaitWriteReg() API.
+ *
  * @tparam Derived The derived class type (CRTP pattern)
  */
 template <typename Derived> class SpiInterface {
@@ -73,4 +117,100 @@ protected:
   ~SpiInterface() = default;
 };
 
+/**
+ * @brief Detects the optional frame-list hook `transfer_frames()` on a bus type.
+ */
+template <typename Bus>
+concept SupportsFrameListTransfer = requires(Bus &bus, const uint8_t *tx, uint8_t *rx,
+                                             std::size_t n) {
+  { bus.transfer_frames(tx, rx, n, n) } -> std::same_as<void>;
+};
+
+/**
+ * @brief Detects the optional CS-edge capture hook `frame_timestamp()`.
+ *
+ * A frame-list bus may record when each frame of the last transfer_frames()
+ * call started (CS falling edge), e.g. from its SPI interrupt or a timer
+ * capture, and return it as
+ * @code
+ *   uint64_t frame_timestamp(std::size_t frame_index) const;
+ * @endcode
+ * in the ticks of the driver's clock policy. The driver then timestamps samples
+ * with these instants instead of reading the clock around the transfer.
+ */
+template <typename Bus>
+concept SupportsFrameTimestamps =
+    SupportsFrameListTransfer<Bus> && requires(const Bus &bus, std::size_t i) {
+      { bus.frame_timestamp(i) } -> std::convertible_to<uint64_t>;
+    };
+
+/**
+ * @brief Detects the optional asynchronous hooks `begin_transfer()`/`is_done()`.
+ */
+template <typename Bus>
+concept SupportsAsyncTransfer = requires(Bus &bus, const uint8_t *tx, uint8_t *rx,
+                                         std::size_t n) {
+  { bus.begin_transfer(tx, rx, n, n) } -> std::convertible_to<bool>;
+  { bus.is_done() } -> std::convertible_to<bool>;
+};
+
+/**
+ * @brief Detects the optional `wait_yield()` hook of an async bus.
+ *
+ * Called between is_done() polls while the driver has to wait for an
+ * asynchronous transfer, e.g. to yield to other RTOS tasks. Without it the
+ * wait is a busy loop.
+ */
+template <typename Bus>
+concept SupportsWaitYield = SupportsAsyncTransfer<Bus> && requires(Bus &bus) { bus.wait_yield(); };
+
+/**
+ * @brief Block until an asynchronous transfer completes, yielding between polls if the bus can.
+ */
+template <typename Bus>
+  requires SupportsAsyncTransfer<Bus>
+void WaitForTransfer(Bus &bus) {
+  while (!bus.is_done()) {
+    if constexpr (SupportsWaitYield<Bus>) {
+      bus.wait_yield();
+    }
+  }
+}
+
+#if AS5047U_HAS_COROUTINES
+/**
+ * @brief Detects the optional coroutine hook `resume_when_done()` on an async bus.
+ */
+template <typename Bus>
+concept SupportsCoroutineResume =
+    SupportsAsyncTransfer<Bus> && requires(Bus &bus, std::coroutine_handle<> handle) {
+      bus.resume_when_done(handle);
+    };
+#endif
+
+/**
+ * @brief Transfer a list of equally sized frames, toggling CS between frames.
+ *
+ * Dispatches to `Bus::transfer_frames()` when available, otherwise issues one
+ * `transfer()` per frame.
+ *
+ * @param bus SPI bus implementation.
+ * @param tx Contiguous transmit frames (frame_len * frame_count bytes).
+ * @param rx Contiguous receive frames, or nullptr to ignore received data.
+ * @param frame_len Bytes per frame.
+ * @param frame_count Number of frames.
+ */
+template <typename Bus>
+void TransferFrames(Bus &bus, const uint8_t *tx, uint8_t *rx, std::size_t frame_len,
+                    std::size_t frame_count) {
+  if constexpr (SupportsFrameListTransfer<Bus>) {
+    bus.transfer_frames(tx, rx, frame_len, frame_count);
+  } else {
+    for (std::size_t i = 0; i < frame_count; ++i) {
+      bus.transfer(tx + (i * frame_len), (rx != nullptr) ? rx + (i * frame_len) : nullptr,
+                   frame_len);
+    }
+  }
+}
+
 } // namespace as5047u
@@ -16,6 +16,50 @@ enum class FrameFormat : uint8_t {
            */
 };
 
+/**
+ * @brief Default second template argument of AS5047U: the frame format is chosen at run time.
+ *
+ * Pass a FrameFormat value instead (e.g. AS5047U<Bus, FrameFormat::SPI_24>) to fix the
+ * format at compile time.
+ */
+struct RuntimeFrameFormat {};
+
+/**
+ * @brief One entry of a chained register write (see AS5047U::WriteRegs()).
+ */
+struct RegisterWrite {
+  uint16_t address; /**< 14-bit register address */
+  uint16_t value;   /**< 14-bit value to write */
+};
+
+/**
+ * @brief When a register write is checked against the device.
+ *
+ * The AS5047U returns a written register's new content in the frame after the
+ * data frame. Immediate spends that frame (a NOP, or the next write of a chain)
+ * on every write; Deferred and None send only the command and data frames.
+ */
+enum class WriteVerify : uint8_t {
+  Immediate, /**< Verify each write right away (cmd + data + NOP) */
+  Deferred,  /**< Queue the write; AS5047U::VerifyPendingWrites() checks the queue in one read */
+  None       /**< Never read back. Only CRC/status errors in the responses to the command and
+                  data frames (plus ERRFL) reach the sticky flags; a write the device silently
+                  ignores is not detected */
+};
+
+/**
+ * @brief How the driver refreshes its sticky error flags after a register read.
+ *
+ * Every MISO data frame carries two status bits next to the 14-bit data
+ * (16-bit: bit15; 24-bit: bits 23/22; 32-bit: bits 31/30). In InFrame mode the
+ * driver relies on those bits and only reads ERRFL when one of them is set,
+ * which halves the bus cost of a healthy read (2 frames instead of 4).
+ */
+enum class ErrorCheckMode : uint8_t {
+  ReadErrfl, /**< Read ERRFL after every register read (cmd + NOP + ERRFL cmd + NOP) */
+  InFrame    /**< Decode the status bits of the data frame; read ERRFL only if one is set */
+};
+
 /**
  * @brief Presets for the adaptive velocity/angle filter (Dynamic Filter System).
  *
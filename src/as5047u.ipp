@@ -17,9 +17,42 @@
 namespace as5047u {
 
 // Member function definitions
-template <typename SpiType>
-void AS5047U<SpiType>::SetFrameFormat(FrameFormat format) noexcept {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetFrameFormat(FrameFormat format) noexcept
+  requires(!FIXED_FRAME_FORMAT)
+{
   this->frame_format_ = format;
+  this->pipeline_address_ = NO_PENDING_READ;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetErrorCheckMode(ErrorCheckMode mode) noexcept {
+  this->error_check_mode_ = mode;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+ErrorCheckMode AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetErrorCheckMode() const noexcept {
+  return this->error_check_mode_;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetWriteVerify(WriteVerify verify) noexcept {
+  this->write_verify_ = verify;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+WriteVerify AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetWriteVerify() const noexcept {
+  return this->write_verify_;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::VerifyPendingWrites() {
+  return verifyDeferredWrites();
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+std::size_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetPendingWriteCount() const noexcept {
+  return this->deferred_count_;
 }
 
 // ══════════════════════════════════════════════════════════════════════════════════════════
@@ -34,23 +67,13 @@ void AS5047U<SpiType>::SetFrameFormat(FrameFormat format) noexcept {
 //                                 PUBLIC HIGH-LEVEL API
 // ══════════════════════════════════════════════════════════════════════════════════════════
 
-template <typename SpiType>
-uint16_t AS5047U<SpiType>::GetAngle(uint8_t retries) const {
-  uint16_t val = 0;
-  constexpr uint16_t retryMask = static_cast<uint16_t>(AS5047U_Error::CrcError) |
-                                 static_cast<uint16_t>(AS5047U_Error::FramingError);
-  for (uint8_t i = 0; i <= retries; ++i) {
-    val = this->template ReadReg<AS5047U_REG::ANGLECOM>().bits.ANGLECOM_value;
-    auto err = GetStickyErrorFlags();
-    if ((static_cast<uint16_t>(err) & retryMask) == 0U) {
-      break;
-    }
-  }
-  return val;
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetAngle(uint8_t retries) const {
+  return GetAngleResult(retries).value;
 }
 
-template <typename SpiType>
-float AS5047U<SpiType>::GetAngle(AngleUnit unit, uint8_t retries) const {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+float AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetAngle(AngleUnit unit, uint8_t retries) const {
   switch (unit) {
     case AngleUnit::Lsb:
       return static_cast<float>(GetAngle(retries));
@@ -63,49 +86,33 @@ float AS5047U<SpiType>::GetAngle(AngleUnit unit, uint8_t retries) const {
   }
 }
 
-template <typename SpiType>
-float AS5047U<SpiType>::GetAngleDegrees(uint8_t retries) const {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+float AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetAngleDegrees(uint8_t retries) const {
   return static_cast<float>(GetAngle(retries)) * Angle::DEG_PER_LSB;
 }
 
-template <typename SpiType>
-float AS5047U<SpiType>::GetAngleRadians(uint8_t retries) const {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+float AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetAngleRadians(uint8_t retries) const {
   return static_cast<float>(GetAngle(retries)) * Angle::RAD_PER_LSB;
 }
 
-template <typename SpiType>
-uint16_t AS5047U<SpiType>::GetRawAngle(uint8_t retries) const {
-  uint16_t val = 0;
-  constexpr uint16_t retryMask = static_cast<uint16_t>(AS5047U_Error::CrcError) |
-                                 static_cast<uint16_t>(AS5047U_Error::FramingError);
-  for (uint8_t i = 0; i <= retries; ++i) {
-    val = this->template ReadReg<AS5047U_REG::ANGLEUNC>().bits.ANGLEUNC_value;
-    auto err = GetStickyErrorFlags();
-    if ((static_cast<uint16_t>(err) & retryMask) == 0U) {
-      break;
-    }
-  }
-  return val;
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetAngleContinuous() const {
+  return this->template ReadRegContinuous<AS5047U_REG::ANGLECOM>().bits.ANGLECOM_value;
 }
 
-template <typename SpiType>
-int16_t AS5047U<SpiType>::GetVelocity(uint8_t retries) const {
-  int16_t val = 0;
-  constexpr uint16_t retryMask = static_cast<uint16_t>(AS5047U_Error::CrcError) |
-                                 static_cast<uint16_t>(AS5047U_Error::FramingError);
-  for (uint8_t i = 0; i <= retries; ++i) {
-    auto v = this->template ReadReg<AS5047U_REG::VEL>().bits.VEL_value;
-    val = static_cast<int16_t>((static_cast<int16_t>(v << 2)) >> 2);
-    auto err = GetStickyErrorFlags();
-    if ((static_cast<uint16_t>(err) & retryMask) == 0U) {
-      break;
-    }
-  }
-  return val;
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetRawAngle(uint8_t retries) const {
+  return GetRawAngleResult(retries).value;
 }
 
-template <typename SpiType>
-float AS5047U<SpiType>::GetVelocity(VelocityUnit unit, uint8_t retries) const {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+int16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetVelocity(uint8_t retries) const {
+  return GetVelocityResult(retries).value;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+float AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetVelocity(VelocityUnit unit, uint8_t retries) const {
   switch (unit) {
     case VelocityUnit::Lsb:
       return static_cast<float>(GetVelocity(retries));
@@ -120,53 +127,134 @@ float AS5047U<SpiType>::GetVelocity(VelocityUnit unit, uint8_t retries) const {
   }
 }
 
-template <typename SpiType>
-float AS5047U<SpiType>::GetVelocityDegPerSec(uint8_t retries) const {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+float AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetVelocityDegPerSec(uint8_t retries) const {
   return GetVelocity(retries) * Velocity::DEG_PER_LSB;
 }
 
-template <typename SpiType>
-float AS5047U<SpiType>::GetVelocityRadPerSec(uint8_t retries) const {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+float AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetVelocityRadPerSec(uint8_t retries) const {
   return GetVelocity(retries) * Velocity::RAD_PER_LSB;
 }
 
-template <typename SpiType>
-float AS5047U<SpiType>::GetVelocityRPM(uint8_t retries) const {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+float AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetVelocityRPM(uint8_t retries) const {
   return GetVelocity(retries) * Velocity::RPM_PER_LSB;
 }
 
-template <typename SpiType>
-uint8_t AS5047U<SpiType>::GetAGC(uint8_t retries) const {
-  uint8_t val = 0;
-  constexpr uint16_t retryMask = static_cast<uint16_t>(AS5047U_Error::CrcError) |
-                                 static_cast<uint16_t>(AS5047U_Error::FramingError);
-  for (uint8_t i = 0; i <= retries; ++i) {
-    val = this->template ReadReg<AS5047U_REG::AGC>().bits.AGC_value;
-    auto err = GetStickyErrorFlags();
-    if ((static_cast<uint16_t>(err) & retryMask) == 0U) {
-      break;
-    }
-  }
-  return val;
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint8_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetAGC(uint8_t retries) const {
+  return GetAGCResult(retries).value;
 }
 
-template <typename SpiType>
-uint16_t AS5047U<SpiType>::GetMagnitude(uint8_t retries) const {
-  uint16_t val = 0;
-  constexpr uint16_t retryMask = static_cast<uint16_t>(AS5047U_Error::CrcError) |
-                                 static_cast<uint16_t>(AS5047U_Error::FramingError);
-  for (uint8_t i = 0; i <= retries; ++i) {
-    val = this->template ReadReg<AS5047U_REG::MAG>().bits.MAG_value;
-    auto err = GetStickyErrorFlags();
-    if ((static_cast<uint16_t>(err) & retryMask) == 0U) {
-      break;
-    }
-  }
-  return val;
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetMagnitude(uint8_t retries) const {
+  return GetMagnitudeResult(retries).value;
+}
+
+// The Result getters report the errors of the returned read itself, so the retry loop needs no
+// sticky-flag exchange and a clean read costs no atomic read-modify-write at all.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+Result<uint16_t> AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetAngleResult(uint8_t retries) const {
+  const auto reg = this->template readRetried<AS5047U_REG::ANGLECOM>(retries);
+  return {static_cast<uint16_t>(reg.value.bits.ANGLECOM_value), reg.errors};
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+Result<uint16_t> AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetRawAngleResult(uint8_t retries) const {
+  const auto reg = this->template readRetried<AS5047U_REG::ANGLEUNC>(retries);
+  return {static_cast<uint16_t>(reg.value.bits.ANGLEUNC_value), reg.errors};
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+Result<int16_t> AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetVelocityResult(uint8_t retries) const {
+  const auto reg = this->template readRetried<AS5047U_REG::VEL>(retries);
+  return {velocityFromRaw(static_cast<uint16_t>(reg.value.bits.VEL_value)), reg.errors};
+}
+
+// The bus guard keeps another thread's read from replacing the recorded frame time between the
+// read and the sampleTime() call (it compiles away without a locking policy).
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+TimedResult<uint16_t> AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetAngleTimed(uint8_t retries) const {
+  const BusGuard guard(*this);
+  const auto result = GetAngleResult(retries);
+  return {result, sampleTime()};
 }
 
-template <typename SpiType>
-uint16_t AS5047U<SpiType>::GetErrorFlags(uint8_t retries) const {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+TimedResult<int16_t> AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetVelocityTimed(uint8_t retries) const {
+  const BusGuard guard(*this);
+  const auto result = GetVelocityResult(retries);
+  return {result, sampleTime()};
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+TimedResult<uint16_t> AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetAngleContinuousTimed() const {
+  const BusGuard guard(*this);
+  uint16_t errors = 0;
+  const uint16_t raw = continuousReadRegister(AS5047U_REG::ANGLECOM::ADDRESS, errors);
+  mergeStickyErrors(errors);
+  return {{raw, static_cast<AS5047U_Error>(errors)}, sampleTime()};
+}
+
+// One chained read of ANGLECOM, ANGLEUNC and VEL: 4 frames in ErrorCheckMode::InFrame.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+EncoderSample AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ReadSample() const {
+  const BusGuard guard(*this); // keeps the recorded frame time paired with this chain
+  static constexpr std::array<uint16_t, 3> addrs = {AS5047U_REG::ANGLECOM::ADDRESS,
+                                                     AS5047U_REG::ANGLEUNC::ADDRESS,
+                                                     AS5047U_REG::VEL::ADDRESS};
+  std::array<uint16_t, 3> raw{};
+  std::array<uint8_t, (3U + 2U) * MAX_FRAME_BYTES> tx{};
+  std::array<uint8_t, (3U + 2U) * MAX_FRAME_BYTES> rx{};
+  uint16_t errors = 0;
+  readRegisterChain(addrs.data(), raw.data(), addrs.size(), tx.data(), rx.data(), errors);
+  mergeStickyErrors(errors);
+  EncoderSample sample{};
+  sample.timestamp = sampleTime();
+  sample.angle = raw[0];
+  sample.raw_angle = raw[1];
+  sample.velocity = velocityFromRaw(raw[2]);
+  sample.errors = static_cast<AS5047U_Error>(errors);
+  return sample;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+std::size_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ReadAngles(std::span<uint16_t> angles,
+                                                             std::span<uint8_t> error_bitmap) const {
+  static constexpr uint16_t pattern[1] = {AS5047U_REG::ANGLECOM::ADDRESS};
+  return burstRead(pattern, 1, angles.size(), error_bitmap,
+                   [&](std::size_t sample, std::size_t /*slot*/, uint16_t value) { angles[sample] = value; });
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+std::size_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ReadAnglesVelocities(std::span<AngleVelocity> samples,
+                                                                       std::span<uint8_t> error_bitmap) const {
+  static constexpr uint16_t pattern[2] = {AS5047U_REG::ANGLECOM::ADDRESS, AS5047U_REG::VEL::ADDRESS};
+  return burstRead(pattern, 2, samples.size(), error_bitmap,
+                   [&](std::size_t sample, std::size_t slot, uint16_t value) {
+                     if (slot == 0U) {
+                       samples[sample].angle = value;
+                     } else {
+                       samples[sample].velocity = velocityFromRaw(value);
+                     }
+                   });
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+Result<uint8_t> AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetAGCResult(uint8_t retries) const {
+  const auto reg = this->template readRetried<AS5047U_REG::AGC>(retries);
+  return {static_cast<uint8_t>(reg.value.bits.AGC_value), reg.errors};
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+Result<uint16_t> AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetMagnitudeResult(uint8_t retries) const {
+  const auto reg = this->template readRetried<AS5047U_REG::MAG>(retries);
+  return {static_cast<uint16_t>(reg.value.bits.MAG_value), reg.errors};
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetErrorFlags(uint8_t retries) const {
   uint16_t val = 0;
   for (uint8_t i = 0; i <= retries; ++i) {
     val = this->template ReadReg<AS5047U_REG::ERRFL>().value;
@@ -177,64 +265,43 @@ uint16_t AS5047U<SpiType>::GetErrorFlags(uint8_t retries) const {
   return val;
 }
 
-template <typename SpiType>
-uint16_t AS5047U<SpiType>::GetZeroPosition(uint8_t retries) const {
-  uint8_t m = 0;
-  uint8_t l = 0;
-  constexpr uint16_t retryMask = static_cast<uint16_t>(AS5047U_Error::CrcError) |
-                                 static_cast<uint16_t>(AS5047U_Error::FramingError);
-
-  // First read ZPOSM with retries
-  for (uint8_t i = 0; i <= retries; ++i) {
-    m = this->template ReadReg<AS5047U_REG::ZPOSM>().bits.ZPOSM_bits;
-    auto err = GetStickyErrorFlags();
-    if ((static_cast<uint16_t>(err) & retryMask) == 0U) {
-      break;
-    }
-  }
-
-  // Then read ZPOSL with retries
-  for (uint8_t i = 0; i <= retries; ++i) {
-    l = this->template ReadReg<AS5047U_REG::ZPOSL>().bits.ZPOSL_bits;
-    auto err = GetStickyErrorFlags();
-    if ((static_cast<uint16_t>(err) & retryMask) == 0U) {
-      break;
-    }
-  }
-
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetZeroPosition(uint8_t retries) const {
+  const auto m = this->template readRetried<AS5047U_REG::ZPOSM>(retries).value.bits.ZPOSM_bits;
+  const auto l = this->template readRetried<AS5047U_REG::ZPOSL>(retries).value.bits.ZPOSL_bits;
   return static_cast<uint16_t>((m << 6) | l);
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::SetZeroPosition(uint16_t angle_lsb, uint8_t retries) {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetZeroPosition(uint16_t angle_lsb, uint8_t retries) {
   AS5047U_REG::ZPOSM m{};
   m.bits.ZPOSM_bits = (angle_lsb >> 6) & 0xFF;
   AS5047U_REG::ZPOSL l{};
   l.bits.ZPOSL_bits = angle_lsb & 0x3F;
-  return this->template WriteReg(m, retries) && this->template WriteReg(l, retries);
+  return this->template writeRegs(retries, m, l);
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::SetABIResolution(uint8_t resolution_bits, uint8_t retries) {
-  resolution_bits = std::clamp(resolution_bits, uint8_t(10), uint8_t(14));
-  // Datasheet SETTINGS3 ABIRES (binary mode): 12-bit=0, 11=1, 10=2, 13=3, 14=4 (non-linear)
-  static constexpr uint8_t kBitsToAbires[] = {2, 1, 0, 3, 4};  // index (bits-10) -> ABIRES code
-  auto s3 = this->template ReadReg<AS5047U_REG::SETTINGS3>();
-  s3.bits.ABIRES = kBitsToAbires[resolution_bits - 10];
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetABIResolution(uint8_t resolution_bits, uint8_t retries) {
+  const BusGuard guard(*this); // the read-modify-write is one locked sequence
+  auto s3 = this->template readConfig<AS5047U_REG::SETTINGS3>();
+  s3.bits.ABIRES = abiResolutionCode(resolution_bits);
   return this->template WriteReg(s3, retries);
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::SetUVWPolePairs(uint8_t pairs, uint8_t retries) {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetUVWPolePairs(uint8_t pairs, uint8_t retries) {
+  const BusGuard guard(*this);
   pairs = std::clamp(pairs, uint8_t(1), uint8_t(7));
-  auto s3 = this->template ReadReg<AS5047U_REG::SETTINGS3>();
+  auto s3 = this->template readConfig<AS5047U_REG::SETTINGS3>();
   s3.bits.UVWPP = static_cast<uint8_t>(pairs - 1);
   return this->template WriteReg(s3, retries);
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::SetIndexPulseLength(uint8_t lsb_len, uint8_t retries) {
-  auto s2 = this->template ReadReg<AS5047U_REG::SETTINGS2>();
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetIndexPulseLength(uint8_t lsb_len, uint8_t retries) {
+  const BusGuard guard(*this);
+  auto s2 = this->template readConfig<AS5047U_REG::SETTINGS2>();
   s2.bits.IWIDTH = (lsb_len == 1) ? 1 : 0;
   return this->template WriteReg(s2, retries);
 }
@@ -250,10 +317,11 @@ bool AS5047U<SpiType>::SetIndexPulseLength(uint8_t lsb_len, uint8_t retries) {
 // |  0  |  0  |  1  |   -       |   PWM      |
 // |  0  |  0  |  0  |   -       |   -        |
 //
-template <typename SpiType>
-bool AS5047U<SpiType>::ConfigureInterface(bool abi, bool uvw, bool pwm, uint8_t retries) {
-  auto dis = this->template ReadReg<AS5047U_REG::DISABLE>();
-  auto s2 = this->template ReadReg<AS5047U_REG::SETTINGS2>();
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigureInterface(bool abi, bool uvw, bool pwm, uint8_t retries) {
+  const BusGuard guard(*this);
+  auto dis = this->template readConfig<AS5047U_REG::DISABLE>();
+  auto s2 = this->template readConfig<AS5047U_REG::SETTINGS2>();
   dis.bits.ABI_off = abi ? 0 : 1;
   dis.bits.UVW_off = uvw ? 0 : 1;
   if (abi && !uvw) {
@@ -266,101 +334,116 @@ bool AS5047U<SpiType>::ConfigureInterface(bool abi, bool uvw, bool pwm, uint8_t
     s2.bits.UVW_ABI = 0;
     s2.bits.PWMon = pwm;
   }
-  return this->template WriteReg(dis, retries) && this->template WriteReg(s2, retries);
+  return this->template writeRegs(retries, dis, s2);
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::SetDynamicAngleCompensation(bool enable, uint8_t retries) {
-  auto s2 = this->template ReadReg<AS5047U_REG::SETTINGS2>();
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetDynamicAngleCompensation(bool enable, uint8_t retries) {
+  const BusGuard guard(*this);
+  auto s2 = this->template readConfig<AS5047U_REG::SETTINGS2>();
   s2.bits.DAECDIS = enable ? 0 : 1;
   return this->template WriteReg(s2, retries);
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::SetAdaptiveFilter(bool enable, uint8_t retries) {
-  auto dis = this->template ReadReg<AS5047U_REG::DISABLE>();
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetAdaptiveFilter(bool enable, uint8_t retries) {
+  const BusGuard guard(*this);
+  auto dis = this->template readConfig<AS5047U_REG::DISABLE>();
   dis.bits.FILTER_disable = enable ? 0 : 1;
   return this->template WriteReg(dis, retries);
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::SetFilterParameters(uint8_t k_min, uint8_t k_max, uint8_t retries) {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetFilterParameters(uint8_t k_min, uint8_t k_max, uint8_t retries) {
+  const BusGuard guard(*this);
   k_min = std::min(k_min, uint8_t(7));
   k_max = std::min(k_max, uint8_t(7));
-  auto s1 = this->template ReadReg<AS5047U_REG::SETTINGS1>();
+  auto s1 = this->template readConfig<AS5047U_REG::SETTINGS1>();
   s1.bits.K_min = k_min;
   s1.bits.K_max = k_max;
   return this->template WriteReg(s1, retries);
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::SetFilterPreset(FilterPreset preset, uint8_t retries) {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetFilterPreset(FilterPreset preset, uint8_t retries) {
+  const BusGuard guard(*this);
   if (!SetAdaptiveFilter(true, retries)) {
     return false;
   }
+  const auto [k_min_code, k_max_code] = filterPresetCodes(preset);
+  return SetFilterParameters(k_min_code, k_max_code, retries);
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint8_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::abiResolutionCode(uint8_t resolution_bits) noexcept {
+  resolution_bits = std::clamp(resolution_bits, uint8_t(10), uint8_t(14));
+  // Datasheet SETTINGS3 ABIRES (binary mode): 12-bit=0, 11=1, 10=2, 13=3, 14=4 (non-linear)
+  static constexpr uint8_t kBitsToAbires[] = {2, 1, 0, 3, 4};  // index (bits-10) -> ABIRES code
+  return kBitsToAbires[resolution_bits - 10];
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+std::pair<uint8_t, uint8_t> AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::filterPresetCodes(FilterPreset preset) noexcept {
   // Register codes for SETTINGS1 K_min/K_max. See SETTINGS1 enums; presets use
   // (K_min_code, K_max_code) to get effective K per datasheet Figure 17.
-  uint8_t k_min_code = 0;
-  uint8_t k_max_code = 0;
   switch (preset) {
     case FilterPreset::LowNoise:
-      k_min_code = 5;  // actual K = 0
-      k_max_code = 6;  // actual K = 0
-      break;
+      return {5, 6};  // actual K = 0 / 0
     case FilterPreset::Balanced:
-      k_min_code = 0;  // actual K = 2
-      k_max_code = 3;  // actual K = 3
-      break;
+      return {0, 3};  // actual K = 2 / 3
     case FilterPreset::HighBandwidth:
-      k_min_code = 4;  // actual K = 6
-      k_max_code = 0;  // actual K = 6
-      break;
+      return {4, 0};  // actual K = 6 / 6
   }
-  return SetFilterParameters(k_min_code, k_max_code, retries);
+  return {0, 0};
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::GetAdaptiveFilterEnabled(uint8_t retries) const {
-  constexpr uint16_t retryMask = static_cast<uint16_t>(AS5047U_Error::CrcError) |
-                                 static_cast<uint16_t>(AS5047U_Error::FramingError);
-  auto dis = this->template ReadReg<AS5047U_REG::DISABLE>();
-  for (uint8_t i = 0; i < retries; ++i) {
-    if ((static_cast<uint16_t>(GetStickyErrorFlags()) & retryMask) == 0) {
-      break;
-    }
-    dis = this->template ReadReg<AS5047U_REG::DISABLE>();
-  }
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetAdaptiveFilterEnabled(uint8_t retries) const {
+  const auto dis = this->template readRetried<AS5047U_REG::DISABLE>(retries).value;
   return (dis.bits.FILTER_disable == 0);
 }
 
-template <typename SpiType>
-std::pair<uint8_t, uint8_t> AS5047U<SpiType>::GetFilterParameters(uint8_t retries) const {
-  constexpr uint16_t retryMask = static_cast<uint16_t>(AS5047U_Error::CrcError) |
-                                 static_cast<uint16_t>(AS5047U_Error::FramingError);
-  auto s1 = this->template ReadReg<AS5047U_REG::SETTINGS1>();
-  for (uint8_t i = 0; i < retries; ++i) {
-    if ((static_cast<uint16_t>(GetStickyErrorFlags()) & retryMask) == 0) {
-      break;
-    }
-    s1 = this->template ReadReg<AS5047U_REG::SETTINGS1>();
-  }
-  return {s1.bits.K_min, s1.bits.K_max};
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+std::pair<uint8_t, uint8_t> AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetFilterParameters(uint8_t retries) const {
+  const auto s1 = this->template readRetried<AS5047U_REG::SETTINGS1>(retries).value;
+  return {static_cast<uint8_t>(s1.bits.K_min), static_cast<uint8_t>(s1.bits.K_max)};
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::Set150CTemperatureMode(bool enable, uint8_t retries) {
-  auto s2 = this->template ReadReg<AS5047U_REG::SETTINGS2>();
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::Set150CTemperatureMode(bool enable, uint8_t retries) {
+  const BusGuard guard(*this);
+  auto s2 = this->template readConfig<AS5047U_REG::SETTINGS2>();
   s2.bits.NOISESET = enable ? 1 : 0;
   return this->template WriteReg(s2, retries);
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::ProgramOTP() {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ProgramOTP() {
+  const BusGuard guard(*this);
+  if constexpr (FIXED_FRAME_FORMAT) {
+    if constexpr (Format == FrameFormat::SPI_16) {
+      // A fixed 16-bit driver cannot switch formats: run the sequence through a 24-bit driver
+      // on the same bus so every OTP frame is CRC-protected, then fold its errors into ours.
+      AS5047U<SpiType, FrameFormat::SPI_24, LogPolicy, SingleThreaded> crc_driver(spi_);
+      crc_driver.SetErrorCheckMode(this->error_check_mode_);
+      crc_driver.SetWriteVerify(WriteVerify::Immediate);
+      verifyDeferredWrites();
+      const bool ok = crc_driver.ProgramOTP();
+      sticky_errors_.fetch_or(static_cast<uint16_t>(crc_driver.GetStickyErrorFlags()));
+      this->pipeline_address_ = NO_PENDING_READ;
+      InvalidateConfigCache();
+      return ok;
+    }
+  }
   // Save current frame format and ensure we use CRC for OTP programming
   FrameFormat backup = this->frame_format_;
   if (this->frame_format_ == FrameFormat::SPI_16) {
     this->frame_format_ = FrameFormat::SPI_24;
   }
+  // Every OTP step is verified immediately; settle writes still waiting for a deferred check
+  verifyDeferredWrites();
+  const WriteVerify verify_backup = this->write_verify_;
+  this->write_verify_ = WriteVerify::Immediate;
 
   // Set current angle as zero position
   SetZeroPosition(GetAngle());
@@ -383,6 +466,7 @@ bool AS5047U<SpiType>::ProgramOTP() {
   for (uint16_t a = 0x0016; a <= 0x001A; ++a) {
     if (readRegister(a) != volatile_shadow[a - 0x0016]) {
       this->frame_format_ = backup;
+      this->write_verify_ = verify_backup;
       return false;
     }
   }
@@ -408,90 +492,456 @@ bool AS5047U<SpiType>::ProgramOTP() {
       this->template WriteReg(p);
       p.bits.OTPREF = 0;
       this->template WriteReg(p);
+      InvalidateConfigCache(); // shadow registers were reloaded from OTP
 
       // Verify shadow registers match OTP
       for (uint16_t a = 0x0016; a <= 0x001A; ++a) {
         if (readRegister(a) != volatile_shadow[a - 0x0016]) {
           this->frame_format_ = backup;
+          this->write_verify_ = verify_backup;
           return false;
         }
       }
+      this->write_verify_ = verify_backup;
       return true;
     }
   }
 
   // Restore original frame format and return failure if timeout
   this->frame_format_ = backup;
+  this->write_verify_ = verify_backup;
   return false;
 }
 
-template <typename SpiType>
-void AS5047U<SpiType>::updateStickyErrors(uint16_t err_fl) const {
-  // Map ERRFL bits (0-10) to sticky error enum
-  if (err_fl & (1u << 0))
-    sticky_errors_ |= static_cast<uint16_t>(AS5047U_Error::AgcWarning);
-  if (err_fl & (1u << 1))
-    sticky_errors_ |= static_cast<uint16_t>(AS5047U_Error::MagHalf);
-  if (err_fl & (1u << 2))
-    sticky_errors_ |= static_cast<uint16_t>(AS5047U_Error::P2ramWarning);
-  if (err_fl & (1u << 3))
-    sticky_errors_ |= static_cast<uint16_t>(AS5047U_Error::P2ramError);
-  if (err_fl & (1u << 4))
-    sticky_errors_ |= static_cast<uint16_t>(AS5047U_Error::FramingError);
-  if (err_fl & (1u << 5))
-    sticky_errors_ |= static_cast<uint16_t>(AS5047U_Error::CommandError);
-  if (err_fl & (1u << 6))
-    sticky_errors_ |= static_cast<uint16_t>(AS5047U_Error::CrcError);
-  if (err_fl & (1u << 7))
-    sticky_errors_ |= static_cast<uint16_t>(AS5047U_Error::WatchdogError);
-  if (err_fl & (1u << 9))
-    sticky_errors_ |= static_cast<uint16_t>(AS5047U_Error::OffCompError);
-  if (err_fl & (1u << 10))
-    sticky_errors_ |= static_cast<uint16_t>(AS5047U_Error::CordicOverflow);
-}
-
-template <typename SpiType>
-AS5047U_Error AS5047U<SpiType>::GetStickyErrorFlags() const {
+// ERRFL and AS5047U_Error share bit positions, so the mapping is a mask and the update is one
+// atomic OR (none at all for a clean ERRFL).
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::updateStickyErrors(uint16_t err_fl) const {
+  mergeStickyErrors(errflToErrors(err_fl));
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+AS5047U_Error AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetStickyErrorFlags() const {
   uint16_t val = sticky_errors_.exchange(0);
   return static_cast<AS5047U_Error>(val);
 }
 
+// ══════════════════════════════════════════════════════════════════════════════════════════
+//                                   BURST CAPTURE
+// ══════════════════════════════════════════════════════════════════════════════════════════
+
+// Frame g carries command g (pattern[g % period], a NOP for the last frame) and returns the
+// response to command g-1, so `samples * period` values cost one extra frame in total. The TX
+// chunk is assembled once: BURST_CHUNK_FRAMES is a multiple of every period, so each chunk
+// repeats the same command pattern and only the final NOP is patched in.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+template <typename Sink>
+std::size_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::burstRead(const uint16_t* pattern, std::size_t period,
+                                                                 std::size_t samples, std::span<uint8_t> error_bitmap,
+                                                                 Sink&& sink) const {
+  static_assert(BURST_CHUNK_FRAMES % 2U == 0U, "burst chunks must hold whole command patterns");
+  const BusGuard guard(*this);
+  const std::size_t values = samples * period;
+  const std::size_t bitmap_bits = std::min(samples, error_bitmap.size() * 8U);
+  std::fill_n(error_bitmap.begin(), (bitmap_bits + 7U) / 8U, uint8_t{0});
+  if (values == 0U) {
+    return 0;
+  }
+
+  const std::size_t len = frameLength();
+  std::array<uint8_t, BURST_CHUNK_FRAMES * MAX_FRAME_BYTES> tx{};
+  std::array<uint8_t, BURST_CHUNK_FRAMES * MAX_FRAME_BYTES> rx{};
+  for (std::size_t i = 0; i < BURST_CHUNK_FRAMES; ++i) {
+    encodeReadCommand(pattern[i % period], tx.data() + (i * len));
+  }
+
+  uint16_t errors = 0;
+  uint16_t status = 0;
+  std::size_t flagged = 0;
+  std::size_t last_flagged = samples; // sample already counted in `flagged`
+  const std::size_t frames = values + 1U;
+  for (std::size_t sent = 0; sent < frames;) {
+    const std::size_t n = std::min(BURST_CHUNK_FRAMES, frames - sent);
+    if (sent + n == frames) {
+      encodeReadCommand(AS5047U_REG::NOP::ADDRESS, tx.data() + ((n - 1U) * len));
+    }
+    TransferFrames(spi_, tx.data(), rx.data(), len, n);
+    for (std::size_t j = (sent == 0U) ? 1U : 0U; j < n; ++j) {
+      const std::size_t index = sent + j - 1U; // value index: response to command sent + j - 1
+      uint16_t frame_errors = 0;
+      const uint16_t frame = decodeResponse(rx.data() + (j * len), frame_errors);
+      const std::size_t sample = index / period;
+      sink(sample, index % period, static_cast<uint16_t>(frame & 0x3FFF));
+      status |= frame;
+      errors |= frame_errors;
+      if ((frame_errors != 0U || (frame & FRAME_STATUS_MASK) != 0U) && sample != last_flagged) {
+        last_flagged = sample;
+        ++flagged;
+        if (sample < bitmap_bits) {
+          error_bitmap[sample / 8U] |= static_cast<uint8_t>(1U << (sample % 8U));
+        }
+      }
+    }
+    sent += n;
+  }
+  this->pipeline_address_ = AS5047U_REG::NOP::ADDRESS;
+  if ((status & FRAME_STATUS_MASK) != 0U) {
+    errors |= errflToErrors(rawReadRegister(AS5047U_REG::ERRFL::ADDRESS, errors));
+  }
+  mergeStickyErrors(errors);
+  return flagged;
+}
+
+// ══════════════════════════════════════════════════════════════════════════════════════════
+//                                CONFIGURATION CACHE
+// ══════════════════════════════════════════════════════════════════════════════════════════
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::EnableConfigCache(bool enable) noexcept {
+  const BusGuard guard(*this);
+  this->config_cache_enabled_ = enable;
+  this->config_cache_valid_ = 0;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::IsConfigCacheEnabled() const noexcept {
+  const BusGuard guard(*this);
+  return this->config_cache_enabled_;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::InvalidateConfigCache() noexcept {
+  const BusGuard guard(*this);
+  this->config_cache_valid_ = 0;
+}
+
+// One chained read of the six registers (7-8 frames) instead of six command + NOP pairs; the
+// values reach the cache through readRegisterChain() if no CRC/framing error was flagged.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::RefreshConfigCache() {
+  const BusGuard guard(*this);
+  this->config_cache_valid_ = 0;
+  if (!this->config_cache_enabled_) {
+    return false;
+  }
+  this->template ReadRegs<AS5047U_REG::DISABLE, AS5047U_REG::ZPOSM, AS5047U_REG::ZPOSL,
+                          AS5047U_REG::SETTINGS1, AS5047U_REG::SETTINGS2,
+                          AS5047U_REG::SETTINGS3>();
+  return this->config_cache_valid_ == static_cast<uint8_t>((1U << CONFIG_CACHE_SIZE) - 1U);
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::storeConfigCache(uint16_t address, uint16_t value) const noexcept {
+  // Addresses below DISABLE wrap around to large slot numbers and are rejected too
+  const auto slot = static_cast<uint16_t>((address & 0x3FFF) - CONFIG_CACHE_FIRST);
+  if (!this->config_cache_enabled_ || slot >= CONFIG_CACHE_SIZE) {
+    return;
+  }
+  this->config_cache_[slot] = value & 0x3FFF;
+  this->config_cache_valid_ = static_cast<uint8_t>(this->config_cache_valid_ | (1U << slot));
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::dropConfigCache(uint16_t address) const noexcept {
+  const auto slot = static_cast<uint16_t>((address & 0x3FFF) - CONFIG_CACHE_FIRST);
+  if (slot < CONFIG_CACHE_SIZE) {
+    this->config_cache_valid_ = static_cast<uint8_t>(this->config_cache_valid_ & ~(1U << slot));
+  }
+}
+
+// ══════════════════════════════════════════════════════════════════════════════════════════
+//                              CONFIGURATION TRANSACTIONS
+// ══════════════════════════════════════════════════════════════════════════════════════════
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::BeginConfig(
+    uint8_t retries) {
+  return ConfigTransaction(*this, retries);
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::~ConfigTransaction() {
+  if (this->dirty_ != 0U) {
+    Commit();
+  }
+  release();
+}
+
+// Registers the driver already caches cost nothing; the rest come in one chained read. Each
+// attempt collects its own errors through the errors out-parameter, so only a CRC/framing error
+// of that attempt (RETRY_ERROR_MASK) triggers a retry; every attempt's errors are merged into
+// the sticky flags so the caller still sees them. The bus lock taken here is held until
+// Commit()/Abort(), so the whole transaction is one read-modify-write.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::load() {
+  if (this->loaded_ || this->failed_) {
+    return this->loaded_;
+  }
+  if constexpr (Concurrency::LOCKS_BUS) {
+    if (!this->locked_) {
+      driver_.bus_mutex_.lock();
+      this->locked_ = true;
+    }
+  }
+  std::array<uint16_t, CONFIG_CACHE_SIZE> addrs{};
+  std::size_t count = 0;
+  for (std::size_t slot = 0; slot < CONFIG_CACHE_SIZE; ++slot) {
+    if (driver_.config_cache_enabled_ && (driver_.config_cache_valid_ & (1U << slot)) != 0U) {
+      this->values_[slot] = driver_.config_cache_[slot];
+    } else {
+      addrs[count++] = static_cast<uint16_t>(CONFIG_CACHE_FIRST + slot);
+    }
+  }
+  if (count == 0U) {
+    this->loaded_ = true;
+    return true;
+  }
+
+  std::array<uint16_t, CONFIG_CACHE_SIZE> raw{};
+  std::array<uint8_t, (CONFIG_CACHE_SIZE + 2U) * MAX_FRAME_BYTES> tx{};
+  std::array<uint8_t, (CONFIG_CACHE_SIZE + 2U) * MAX_FRAME_BYTES> rx{};
+  for (uint8_t attempt = 0; attempt <= this->retries_; ++attempt) {
+    uint16_t errors = 0;
+    driver_.readRegisterChain(addrs.data(), raw.data(), count, tx.data(), rx.data(), errors);
+    driver_.mergeStickyErrors(errors);
+    if ((errors & RETRY_ERROR_MASK) == 0U) {
+      for (std::size_t i = 0; i < count; ++i) {
+        this->values_[addrs[i] - CONFIG_CACHE_FIRST] = raw[i];
+      }
+      this->loaded_ = true;
+      return true;
+    }
+  }
+  this->failed_ = true;
+  this->dirty_ = 0;
+  release();
+  return false;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::release() noexcept {
+  if constexpr (Concurrency::LOCKS_BUS) {
+    if (this->locked_) {
+      this->locked_ = false;
+      driver_.bus_mutex_.unlock();
+    }
+  }
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+template <typename RegT, typename Edit>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::Modify(Edit&& edit) {
+  constexpr std::size_t slot = RegT::ADDRESS - CONFIG_CACHE_FIRST;
+  static_assert(RegT::ADDRESS >= CONFIG_CACHE_FIRST && slot < CONFIG_CACHE_SIZE,
+                "ConfigTransaction only edits DISABLE, ZPOSM, ZPOSL and SETTINGS1-3");
+  if (!load()) {
+    return *this;
+  }
+  RegT reg = decode<RegT>(this->values_[slot]);
+  edit(reg);
+  const auto value = static_cast<uint16_t>(encode(reg) & 0x3FFF);
+  if (value != this->values_[slot]) {
+    this->values_[slot] = value;
+    this->dirty_ = static_cast<uint8_t>(this->dirty_ | (1U << slot));
+  }
+  return *this;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+template <typename RegT>
+RegT AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::Get() {
+  constexpr std::size_t slot = RegT::ADDRESS - CONFIG_CACHE_FIRST;
+  static_assert(RegT::ADDRESS >= CONFIG_CACHE_FIRST && slot < CONFIG_CACHE_SIZE,
+                "ConfigTransaction only holds DISABLE, ZPOSM, ZPOSL and SETTINGS1-3");
+  load();
+  return decode<RegT>(this->values_[slot]);
+}
+
+// Dirty registers go out in address order as one chained write. After a failed write the local
+// copy no longer mirrors the device, so the next edit reloads it.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::Commit() {
+  if (this->failed_) {
+    Abort();
+    return false;
+  }
+  std::array<uint16_t, CONFIG_CACHE_SIZE> addrs{};
+  std::array<uint16_t, CONFIG_CACHE_SIZE> values{};
+  std::size_t count = 0;
+  for (std::size_t slot = 0; slot < CONFIG_CACHE_SIZE; ++slot) {
+    if ((this->dirty_ & (1U << slot)) != 0U) {
+      addrs[count] = static_cast<uint16_t>(CONFIG_CACHE_FIRST + slot);
+      values[count] = this->values_[slot];
+      ++count;
+    }
+  }
+  this->dirty_ = 0;
+  std::array<uint8_t, ((2U * CONFIG_CACHE_SIZE) + 1U) * MAX_FRAME_BYTES> tx{};
+  std::array<uint8_t, ((2U * CONFIG_CACHE_SIZE) + 1U) * MAX_FRAME_BYTES> rx{};
+  const bool ok = driver_.writeRegisterChain(addrs.data(), values.data(), count, this->retries_,
+                                             driver_.write_verify_, tx.data(), rx.data());
+  if (!ok || Concurrency::LOCKS_BUS) {
+    // Failed: the copy no longer mirrors the device. Locked: other threads may write once the
+    // lock is released, so the next edit reloads under a fresh lock.
+    this->loaded_ = false;
+  }
+  release();
+  return ok;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::Abort() noexcept {
+  this->dirty_ = 0;
+  this->loaded_ = false;
+  this->failed_ = false;
+  release();
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::SetZeroPosition(uint16_t angle_lsb) {
+  this->template Modify<AS5047U_REG::ZPOSM>(
+      [&](AS5047U_REG::ZPOSM& m) { m.bits.ZPOSM_bits = (angle_lsb >> 6) & 0xFF; });
+  return this->template Modify<AS5047U_REG::ZPOSL>(
+      [&](AS5047U_REG::ZPOSL& l) { l.bits.ZPOSL_bits = angle_lsb & 0x3F; });
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::SetDirection(bool clockwise) {
+  return this->template Modify<AS5047U_REG::SETTINGS2>(
+      [&](AS5047U_REG::SETTINGS2& s2) { s2.bits.DIR = clockwise ? 0 : 1; });
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::SetABIResolution(uint8_t resolution_bits) {
+  return this->template Modify<AS5047U_REG::SETTINGS3>(
+      [&](AS5047U_REG::SETTINGS3& s3) { s3.bits.ABIRES = abiResolutionCode(resolution_bits); });
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::SetUVWPolePairs(uint8_t pairs) {
+  pairs = std::clamp(pairs, uint8_t(1), uint8_t(7));
+  return this->template Modify<AS5047U_REG::SETTINGS3>(
+      [&](AS5047U_REG::SETTINGS3& s3) { s3.bits.UVWPP = static_cast<uint8_t>(pairs - 1); });
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::SetIndexPulseLength(uint8_t lsb_len) {
+  return this->template Modify<AS5047U_REG::SETTINGS2>(
+      [&](AS5047U_REG::SETTINGS2& s2) { s2.bits.IWIDTH = (lsb_len == 1) ? 1 : 0; });
+}
+
+// Same truth table as AS5047U::ConfigureInterface()
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::ConfigureInterface(bool abi, bool uvw, bool pwm) {
+  this->template Modify<AS5047U_REG::DISABLE>([&](AS5047U_REG::DISABLE& dis) {
+    dis.bits.ABI_off = abi ? 0 : 1;
+    dis.bits.UVW_off = uvw ? 0 : 1;
+  });
+  return this->template Modify<AS5047U_REG::SETTINGS2>([&](AS5047U_REG::SETTINGS2& s2) {
+    s2.bits.UVW_ABI = (!abi && uvw) ? 1 : 0;
+    s2.bits.PWMon = pwm;
+  });
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::SetDynamicAngleCompensation(bool enable) {
+  return this->template Modify<AS5047U_REG::SETTINGS2>(
+      [&](AS5047U_REG::SETTINGS2& s2) { s2.bits.DAECDIS = enable ? 0 : 1; });
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::SetAdaptiveFilter(bool enable) {
+  return this->template Modify<AS5047U_REG::DISABLE>(
+      [&](AS5047U_REG::DISABLE& dis) { dis.bits.FILTER_disable = enable ? 0 : 1; });
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::SetFilterPreset(FilterPreset preset) {
+  const auto [k_min_code, k_max_code] = filterPresetCodes(preset);
+  SetAdaptiveFilter(true);
+  return SetFilterParameters(k_min_code, k_max_code);
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::SetFilterParameters(uint8_t k_min, uint8_t k_max) {
+  return this->template Modify<AS5047U_REG::SETTINGS1>([&](AS5047U_REG::SETTINGS1& s1) {
+    s1.bits.K_min = std::min(k_min, uint8_t(7));
+    s1.bits.K_max = std::min(k_max, uint8_t(7));
+  });
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::Set150CTemperatureMode(bool enable) {
+  return this->template Modify<AS5047U_REG::SETTINGS2>(
+      [&](AS5047U_REG::SETTINGS2& s2) { s2.bits.NOISESET = enable ? 1 : 0; });
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::SetHysteresis(
+    AS5047U_REG::SETTINGS3::Hysteresis hysteresis) {
+  return this->template Modify<AS5047U_REG::SETTINGS3>(
+      [&](AS5047U_REG::SETTINGS3& s3) { s3.bits.HYS = static_cast<uint8_t>(hysteresis); });
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction&
+AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ConfigTransaction::SetAngleOutputSource(
+    AS5047U_REG::SETTINGS2::AngleOutputSource source) {
+  return this->template Modify<AS5047U_REG::SETTINGS2>(
+      [&](AS5047U_REG::SETTINGS2& s2) { s2.bits.Data_select = static_cast<uint8_t>(source); });
+}
+
 // Public API implementations
-template <typename SpiType>
-void AS5047U<SpiType>::SetPad(uint8_t pad) noexcept {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetPad(uint8_t pad) noexcept {
   this->pad_byte_ = pad;
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::SetHysteresis(AS5047U_REG::SETTINGS3::Hysteresis hysteresis,
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetHysteresis(AS5047U_REG::SETTINGS3::Hysteresis hysteresis,
                                      uint8_t retries) {
-  auto s3 = this->template ReadReg<AS5047U_REG::SETTINGS3>();
+  const BusGuard guard(*this);
+  auto s3 = this->template readConfig<AS5047U_REG::SETTINGS3>();
   s3.bits.HYS = static_cast<uint8_t>(hysteresis);
   return this->template WriteReg(s3, retries);
 }
 
-template <typename SpiType>
-AS5047U_REG::SETTINGS3::Hysteresis AS5047U<SpiType>::GetHysteresis() const {
-  auto s3 = this->template ReadReg<AS5047U_REG::SETTINGS3>();
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+AS5047U_REG::SETTINGS3::Hysteresis AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetHysteresis() const {
+  auto s3 = this->template readConfig<AS5047U_REG::SETTINGS3>();
   return static_cast<AS5047U_REG::SETTINGS3::Hysteresis>(s3.bits.HYS);
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::SetAngleOutputSource(AS5047U_REG::SETTINGS2::AngleOutputSource source,
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::SetAngleOutputSource(AS5047U_REG::SETTINGS2::AngleOutputSource source,
                                             uint8_t retries) {
-  auto s2 = this->template ReadReg<AS5047U_REG::SETTINGS2>();
+  const BusGuard guard(*this);
+  auto s2 = this->template readConfig<AS5047U_REG::SETTINGS2>();
   s2.bits.Data_select = static_cast<uint8_t>(source);
   return this->template WriteReg(s2, retries);
 }
 
-template <typename SpiType>
-AS5047U_REG::SETTINGS2::AngleOutputSource AS5047U<SpiType>::GetAngleOutputSource() const {
-  auto s2 = this->template ReadReg<AS5047U_REG::SETTINGS2>();
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+AS5047U_REG::SETTINGS2::AngleOutputSource AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetAngleOutputSource() const {
+  auto s2 = this->template readConfig<AS5047U_REG::SETTINGS2>();
   return static_cast<AS5047U_REG::SETTINGS2::AngleOutputSource>(s2.bits.Data_select);
 }
 
-template <typename SpiType>
-AS5047U_REG::DIA AS5047U<SpiType>::GetDiagnostics() const {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+AS5047U_REG::DIA AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::GetDiagnostics() const {
   return this->template ReadReg<AS5047U_REG::DIA>();
 }
 
@@ -504,199 +954,797 @@ AS5047U_REG::DIA AS5047U<SpiType>::GetDiagnostics() const {
 // - 24-bit: Fig.23-25  MOSI 22=RW, 21:8=ADDR, 7:0=CRC; MISO 23=ER, 22=Error, 21:8=DATA[13:0], 7:0=CRC (Fig.25). CRC Fig.31.
 // - 32-bit: Fig.26-28  PAD in B0 (MOSI) / B3 (MISO); MISO B0=[ER,Err,Data13:8], B1=Data7:0, B2=CRC, B3=PAD (Fig.28).
 //
-// Low level register read without sticky error update.
-// DS: "The data is transmitted on MISO with the *next* read command." So we always send
-// (1) read command for address, (2) NOP; the NOP response carries the data for that address.
-template <typename SpiType>
-uint16_t AS5047U<SpiType>::rawReadRegister(uint16_t address) const {
-  uint16_t result = 0;
-  if (this->frame_format_ == FrameFormat::SPI_16) {
-    // ---- 16-bit frame without CRC ----
-    // (1) Read command (bit14=1 for read)
-    uint16_t cmd = static_cast<uint16_t>(0x4000 | (address & 0x3FFF));
-    const uint8_t tx[2] = {static_cast<uint8_t>(cmd >> 8), static_cast<uint8_t>(cmd & 0xFF)};
-    uint8_t rx[2];
-    spi_.transfer(tx, rx, 2);
-
-    // (2) NOP — MISO from this transfer = data for the address we just requested
-    const uint8_t tx_nop[2] = {0x40, 0x00};
-    uint8_t rx_data[2];
-    spi_.transfer(tx_nop, rx_data, 2);
-
-    // Process response
-    uint16_t raw = (static_cast<uint16_t>(rx_data[0]) << 8) | rx_data[1];
-    result = raw & 0x3FFF; // Mask out status flags
-  } else if (this->frame_format_ == FrameFormat::SPI_24) {
-    // ---- 24-bit frame with CRC ----
-    // (1) Read command with CRC
-    uint16_t crc_input = static_cast<uint16_t>((1 << 14) | (address & 0x3FFF));
-    uint8_t crc = ComputeCRC8(crc_input);
-    const uint8_t tx_cmd[3] = {
-        static_cast<uint8_t>(((address >> 8) & 0x3F) | 0x40), // bit6=1 for read
-        static_cast<uint8_t>(address & 0xFF), crc};
-    uint8_t rx_cmd[3];
-    spi_.transfer(tx_cmd, rx_cmd, 3);
-
-    // (2) NOP — MISO from this transfer = data for the requested address
-    uint16_t nop_addr = AS5047U_REG::NOP::ADDRESS;
-    uint16_t nop_crc_input = static_cast<uint16_t>((1 << 14) | (nop_addr & 0x3FFF));
-    uint8_t crc_nop = ComputeCRC8(nop_crc_input);
-    const uint8_t tx_nop[3] = {static_cast<uint8_t>(((nop_addr >> 8) & 0x3F) | 0x40),
-                               static_cast<uint8_t>(nop_addr & 0xFF), crc_nop};
-    uint8_t rx_data_frame[3];
-    spi_.transfer(tx_nop, rx_data_frame, 3);
-
-    // Process response with CRC verification
-    uint16_t raw = (static_cast<uint16_t>(rx_data_frame[0]) << 8) | rx_data_frame[1];
-    uint8_t crc_device = rx_data_frame[2];
+// DS: "The data is transmitted on MISO with the *next* read command." Every read command frame
+// therefore returns the response to the previously sent command. transferReadCommand() sends one
+// read command and hands back that previous response; pipeline_address_ remembers which address
+// the in-flight response belongs to so continuous reads can skip the NOP frame.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::encodeFrame(FrameFormat format, uint16_t payload,
+                                   uint8_t* tx) const noexcept {
+  // MOSI payload: bit14=R/W, 13:0=ADDR (command) or 13:0=DATA (write data frame).
+  // CRC (24/32-bit only) covers bits 15:0.
+  if (format == FrameFormat::SPI_16) {
+    tx[0] = static_cast<uint8_t>(payload >> 8);
+    tx[1] = static_cast<uint8_t>(payload & 0xFF);
+  } else if (format == FrameFormat::SPI_24) {
+    tx[0] = static_cast<uint8_t>(payload >> 8);
+    tx[1] = static_cast<uint8_t>(payload & 0xFF);
+    tx[2] = ComputeCRC8(payload);
+  } else {
+    // 32-bit: PAD in B0, then the 24-bit frame (DS Fig.26-27)
+    tx[0] = this->pad_byte_;
+    tx[1] = static_cast<uint8_t>(payload >> 8);
+    tx[2] = static_cast<uint8_t>(payload & 0xFF);
+    tx[3] = ComputeCRC8(payload);
+  }
+}
+
+// Command frames come from the ROM images in as5047u_frames.hpp; only SPI_32 needs a byte patched
+// (the pad). Addresses outside the register map fall back to encodeFrame().
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::copyFrameImage(FrameFormat format, const FrameImage& image,
+                                      uint8_t* tx) const noexcept {
+  std::copy_n(image.data(), frameLength(format), tx);
+  if (format == FrameFormat::SPI_32) {
+    tx[0] = this->pad_byte_;
+  }
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::encodeReadCommand(uint16_t address, uint8_t* tx) const noexcept {
+  const FrameFormat format = frameFormat();
+  if (const CommandFrameSet* rom = FindCommandFrames(address)) {
+    copyFrameImage(format, rom->read[static_cast<std::size_t>(format)], tx);
+    return;
+  }
+  encodeFrame(format, static_cast<uint16_t>(0x4000 | (address & 0x3FFF)), tx);
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::decodeFrame(FrameFormat format, const uint8_t* rx) const noexcept {
+  uint16_t errors = 0;
+  const uint16_t raw = decodeFrame(format, rx, errors);
+  // Host-side CRC failure: flag it so retry loops fire without waiting for ERRFL
+  mergeStickyErrors(errors);
+  return raw;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::decodeFrame(FrameFormat format, const uint8_t* rx,
+                                                          uint16_t& errors) const noexcept {
+  // 16-bit: MISO bit15=ER, 14=0, 13:0=RDATA.
+  // 24-bit: Byte0=[ER,Err,Data13:8], Byte1=Data7:0, Byte2=CRC over bits 23:8 (Fig.25).
+  // 32-bit: Byte0=[ER,Err,Data13:8], Byte1=Data7:0, Byte2=CRC over bits 31:16, Byte3=PAD (Fig.28).
+  const uint16_t raw = static_cast<uint16_t>((static_cast<uint16_t>(rx[0]) << 8) | rx[1]);
+  if (format != FrameFormat::SPI_16) {
+    uint8_t crc_device = rx[2];
     uint8_t crc_calc = ComputeCRC8(raw);
     if (crc_device != crc_calc) {
-      // crc error, caller will read ERRFL
-    }
-    result = raw & 0x3FFF;
-  } else if (this->frame_format_ == FrameFormat::SPI_32) {
-    // ---- 32-bit frame with CRC and pad byte (DS Fig.26-28) ----
-    // MISO data frame (Fig.28): Bit31=ER, 30=Error, 29:16=Data(14b), 15:8=CRC, 7:0=PAD.
-    // So Byte0=[ER,Err,Data13:8], Byte1=Data7:0, Byte2=CRC, Byte3=PAD. CRC over bits 31:16 (DS p.23).
-    uint16_t crc_input = static_cast<uint16_t>((1 << 14) | (address & 0x3FFF));
-    uint8_t crc = ComputeCRC8(crc_input);
-    const uint8_t tx_cmd[4] = {
-        this->pad_byte_,
-        static_cast<uint8_t>(((address >> 8) & 0x3F) | 0x40), // bit6=1 for read
-        static_cast<uint8_t>(address & 0xFF), crc};
-    uint8_t rx_cmd[4];
-    spi_.transfer(tx_cmd, rx_cmd, 4);
-
-    // (2) NOP — MISO from this transfer = data for the requested address. Fig.28: Byte0/1=Data, Byte2=CRC, Byte3=PAD.
-    uint16_t nop_addr = AS5047U_REG::NOP::ADDRESS;
-    uint16_t nop_crc_input = static_cast<uint16_t>((1 << 14) | (nop_addr & 0x3FFF));
-    uint8_t crc_nop = ComputeCRC8(nop_crc_input);
-    const uint8_t tx_nop[4] = {this->pad_byte_,
-                               static_cast<uint8_t>(((nop_addr >> 8) & 0x3F) | 0x40),
-                               static_cast<uint8_t>(nop_addr & 0xFF), crc_nop};
-    uint8_t rx_data_frame[4];
-    spi_.transfer(tx_nop, rx_data_frame, 4);
-
-    // Data = bits 29:16 = (Byte0 & 0x3F)<<8 | Byte1; CRC = Byte2 (bits 15:8); Byte3 = PAD
-    uint16_t raw = (static_cast<uint16_t>(rx_data_frame[0] & 0x3Fu) << 8) | rx_data_frame[1];
-    uint16_t crc_payload_32 = (static_cast<uint16_t>(rx_data_frame[0]) << 8) | rx_data_frame[1];
-    uint8_t crc_device = rx_data_frame[2];
-    uint8_t crc_calc = ComputeCRC8(crc_payload_32);
-    if (crc_device != crc_calc) {
-      // crc error, caller will read ERRFL
+      errors |= static_cast<uint16_t>(AS5047U_Error::ResponseCrcError);
+    }
+  }
+  return raw;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::decodeResponse(const uint8_t* rx) const noexcept {
+  return decodeFrame(frameFormat(), rx);
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::decodeResponse(const uint8_t* rx, uint16_t& errors) const noexcept {
+  return decodeFrame(frameFormat(), rx, errors);
+}
+
+// DS Fig.30: Write = command frame then data frame. MISO during data = old content.
+// "At the next command" MISO = new content — so a NOP follows the data frame and its
+// response is used to verify the write. CS may toggle between the frames.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::encodeWriteSequence(FrameFormat format, uint16_t address, uint16_t value,
+                                           uint8_t* tx) const noexcept {
+  const std::size_t len = frameLength(format);
+  const auto fmt = static_cast<std::size_t>(format);
+  if (const CommandFrameSet* rom = FindCommandFrames(address)) {
+    copyFrameImage(format, rom->write[fmt], tx);
+  } else {
+    encodeFrame(format, static_cast<uint16_t>(address & 0x3FFF), tx); // bit14=0 for write
+  }
+  encodeFrame(format, static_cast<uint16_t>(value & 0x3FFF), tx + len); // only runtime CRC
+  copyFrameImage(format, COMMAND_FRAMES_OF<AS5047U_REG::NOP>.read[fmt], tx + (2U * len));
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::transferReadCommand(uint16_t address, uint16_t& errors) const {
+  uint8_t tx[MAX_FRAME_BYTES];
+  uint8_t rx[MAX_FRAME_BYTES];
+  encodeReadCommand(address, tx);
+  const uint64_t start = transferStartTime();
+  if constexpr (ClockPolicy::ENABLED && SupportsFrameTimestamps<SpiType>) {
+    TransferFrames(spi_, tx, rx, frameLength(), 1); // frame_timestamp() covers frame lists
+  } else {
+    spi_.transfer(tx, rx, frameLength());
+  }
+  recordFrameTimes(start, 1);
+  this->pipeline_address_ = address & 0x3FFF;
+  return decodeResponse(rx, errors);
+}
+
+// Sends `count` read commands as one frame list (a single bus call when the SPI type provides
+// transfer_frames()). Response i in rx answers the command sent before frame i.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::transferReadCommands(const uint16_t* addrs, std::size_t count, uint8_t* tx,
+                                            uint8_t* rx) const {
+  const BusGuard guard(*this);
+  const std::size_t len = frameLength();
+  for (std::size_t i = 0; i < count; ++i) {
+    encodeReadCommand(addrs[i], tx + (i * len));
+  }
+  const uint64_t start = transferStartTime();
+  TransferFrames(spi_, tx, rx, len, count);
+  recordFrameTimes(start, count);
+  this->pipeline_address_ = addrs[count - 1] & 0x3FFF;
+}
+
+// A value is latched at its command frame. With a bus that captures CS edges those instants are
+// exact; otherwise the first command frame is stamped with the clock reading taken just before
+// the transfer and the last one with the reading taken just after it (late by at most one frame).
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::recordFrameTimes(uint64_t start, std::size_t frames) const noexcept {
+  if constexpr (ClockPolicy::ENABLED) {
+    if constexpr (SupportsFrameTimestamps<SpiType>) {
+      static_cast<void>(start);
+      this->frame_times_.command = static_cast<uint64_t>(spi_.frame_timestamp(0));
+      this->frame_times_.pipeline = static_cast<uint64_t>(spi_.frame_timestamp(frames - 1U));
+    } else {
+      this->frame_times_.command = start;
+      this->frame_times_.pipeline = (frames == 1U) ? start : ClockPolicy::Now();
     }
-    result = raw & 0x3FFF;
+  } else {
+    static_cast<void>(start);
+    static_cast<void>(frames);
   }
-  return result;
 }
 
-// High level read that also fetches ERRFL to update sticky errors
-template <typename SpiType>
-uint16_t AS5047U<SpiType>::readRegister(uint16_t address) const {
-  uint16_t val = rawReadRegister(address);
-  uint16_t err = rawReadRegister(AS5047U_REG::ERRFL::ADDRESS);
-  updateStickyErrors(err);
+// Low level register read without sticky error update: (1) read command for address, (2) NOP.
+// The NOP response carries the data for the requested address plus the in-frame status bits.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::rawReadFrame(uint16_t address, uint16_t& errors) const {
+  const uint16_t addrs[2] = {address, AS5047U_REG::NOP::ADDRESS};
+  uint8_t tx[2 * MAX_FRAME_BYTES];
+  uint8_t rx[2 * MAX_FRAME_BYTES];
+  transferReadCommands(addrs, 2, tx, rx);
+  return decodeResponse(rx + frameLength(), errors);
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::rawReadFrame(uint16_t address) const {
+  uint16_t errors = 0;
+  const uint16_t frame = rawReadFrame(address, errors);
+  mergeStickyErrors(errors);
+  return frame;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::rawReadRegister(uint16_t address, uint16_t& errors) const {
+  return rawReadFrame(address, errors) & 0x3FFF;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::rawReadRegister(uint16_t address) const {
+  return rawReadFrame(address) & 0x3FFF;
+}
+
+// Pipelined read: the command for sample N+1 goes out in the frame that returns sample N.
+// If the in-flight response belongs to another address (first call, or any other access in
+// between), one priming frame is sent first. Errors are always tracked from the in-frame status
+// bits here: ERRFL is only fetched (breaking the pipeline once) when one of them is set.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::continuousReadRegister(uint16_t address, uint16_t& errors) const {
+  const BusGuard guard(*this);
+  uint16_t frame = 0;
+  if (this->pipeline_address_ != (address & 0x3FFF)) {
+    const uint16_t addrs[2] = {address, address};
+    uint8_t tx[2 * MAX_FRAME_BYTES];
+    uint8_t rx[2 * MAX_FRAME_BYTES];
+    transferReadCommands(addrs, 2, tx, rx);
+    latchSampleTime(false);
+    frame = decodeResponse(rx + frameLength(), errors);
+  } else {
+    latchSampleTime(true); // the response answers the previous call's command frame
+    frame = transferReadCommand(address, errors);
+  }
+  if ((frame & FRAME_STATUS_MASK) != 0U) {
+    errors |= errflToErrors(rawReadRegister(AS5047U_REG::ERRFL::ADDRESS, errors));
+  }
+  return frame & 0x3FFF;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::continuousReadRegister(uint16_t address) const {
+  uint16_t errors = 0;
+  const uint16_t value = continuousReadRegister(address, errors);
+  mergeStickyErrors(errors);
+  return value;
+}
+
+// High level read that also fetches ERRFL. In InFrame mode ERRFL is only fetched when the data
+// frame reports an error/warning, so a healthy read is 2 frames. The errors of this read are
+// collected in `errors` (as AS5047U_Error bits) without touching the sticky flags.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::readRegister(uint16_t address, uint16_t& errors) const {
+  const BusGuard guard(*this);
+  uint16_t val = 0;
+  if (this->error_check_mode_ == ErrorCheckMode::InFrame) {
+    const uint16_t frame = rawReadFrame(address, errors);
+    latchSampleTime(false);
+    if ((address & 0x3FFF) == AS5047U_REG::ERRFL::ADDRESS) {
+      // ERRFL clears on read: account for the value we just got instead of re-reading it
+      errors |= errflToErrors(frame & 0x3FFF);
+    } else if ((frame & FRAME_STATUS_MASK) != 0U) {
+      errors |= errflToErrors(rawReadRegister(AS5047U_REG::ERRFL::ADDRESS, errors));
+    }
+    val = frame & 0x3FFF;
+  } else {
+    val = rawReadRegister(address, errors);
+    latchSampleTime(false);
+    errors |= errflToErrors(rawReadRegister(AS5047U_REG::ERRFL::ADDRESS, errors));
+  }
+  if ((errors & RETRY_ERROR_MASK) == 0U) {
+    storeConfigCache(address, val); // only error-free reads fill the configuration cache
+  }
+  return val;
+}
+
+// Read that refreshes the sticky errors with one atomic OR.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::readRegister(uint16_t address) const {
+  uint16_t errors = 0;
+  const uint16_t val = readRegister(address, errors);
+  mergeStickyErrors(errors);
   return val;
 }
 
-template <typename SpiType>
-bool AS5047U<SpiType>::writeRegister(uint16_t address, uint16_t value, uint8_t retries) const {
+// Asynchronous read: the same chained sequence as readRegisterChain() for a single register,
+// handed to the bus's begin_transfer() hook. The frames are decoded in completeAsyncRead().
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::startAsyncRead(uint16_t address)
+  requires ASYNC_TRANSFERS
+{
+  if (this->async_state_ != AsyncState::Idle) {
+    return false;
+  }
+  const bool read_errfl = (this->error_check_mode_ == ErrorCheckMode::ReadErrfl);
+  const std::size_t len = frameLength();
+  encodeReadCommand(address, this->async_tx_.data());
+  std::size_t frames = 1;
+  if (read_errfl) {
+    encodeReadCommand(AS5047U_REG::ERRFL::ADDRESS, this->async_tx_.data() + len);
+    ++frames;
+  }
+  encodeReadCommand(AS5047U_REG::NOP::ADDRESS, this->async_tx_.data() + (frames * len));
+  ++frames;
+  if (!spi_.begin_transfer(this->async_tx_.data(), this->async_rx_.data(), len, frames)) {
+    return false;
+  }
+  this->async_address_ = address & 0x3FFF;
+  this->async_frames_ = static_cast<uint8_t>(frames);
+  this->async_format_ = frameFormat();
+  this->async_state_ = AsyncState::ReadInFlight;
+  this->pipeline_address_ = AS5047U_REG::NOP::ADDRESS;
+  return true;
+}
+
+// Asynchronous pipelined read: like continuousReadRegister(), one command frame in steady state
+// (plus a priming frame when another address is in flight). The response to the previous command
+// is decoded from the last frame in completeAsyncRead().
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::startAsyncContinuousRead(uint16_t address)
+  requires ASYNC_TRANSFERS
+{
+  if (this->async_state_ != AsyncState::Idle) {
+    return false;
+  }
+  const std::size_t len = frameLength();
+  const std::size_t frames = (this->pipeline_address_ == (address & 0x3FFF)) ? 1U : 2U;
+  for (std::size_t i = 0; i < frames; ++i) {
+    encodeReadCommand(address, this->async_tx_.data() + (i * len));
+  }
+  if (!spi_.begin_transfer(this->async_tx_.data(), this->async_rx_.data(), len, frames)) {
+    return false;
+  }
+  this->async_address_ = address & 0x3FFF;
+  this->async_frames_ = static_cast<uint8_t>(frames);
+  this->async_format_ = frameFormat();
+  this->async_state_ = AsyncState::ContinuousReadInFlight;
+  this->pipeline_address_ = address & 0x3FFF;
+  return true;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::IsAsyncReadDone()
+  requires ASYNC_TRANSFERS
+{
+  return (this->async_state_ == AsyncState::Idle) || spi_.is_done();
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::completeAsyncRead()
+  requires ASYNC_TRANSFERS
+{
+  uint16_t errors = 0;
+  const uint16_t value = completeAsyncRead(errors);
+  mergeStickyErrors(errors);
+  return value;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+uint16_t AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::completeAsyncRead(uint16_t& errors)
+  requires ASYNC_TRANSFERS
+{
+  if (this->async_state_ != AsyncState::ReadInFlight &&
+      this->async_state_ != AsyncState::ContinuousReadInFlight) {
+    return 0;
+  }
+  WaitForTransfer(spi_); // the caller should normally poll IsAsyncReadDone() first
+  const bool continuous = (this->async_state_ == AsyncState::ContinuousReadInFlight);
+  this->async_state_ = AsyncState::Idle;
+
+  const std::size_t len = frameLength(this->async_format_);
+  // Chained read: frame 1 answers the command. Continuous read: the last frame carries the
+  // response to the previous command for this address.
+  const std::size_t data_frame = continuous ? (this->async_frames_ - 1U) : 1U;
+  const uint16_t frame =
+      decodeFrame(this->async_format_, this->async_rx_.data() + (data_frame * len), errors);
+  if (!continuous && this->async_frames_ == 3U) {
+    // ReadErrfl: frame 2 answers the ERRFL command
+    errors |= errflToErrors(
+        decodeFrame(this->async_format_, this->async_rx_.data() + (2U * len), errors) & 0x3FFF);
+  } else if (this->async_address_ == AS5047U_REG::ERRFL::ADDRESS) {
+    errors |= errflToErrors(frame & 0x3FFF); // ERRFL clears on read
+  } else if ((frame & FRAME_STATUS_MASK) != 0U) {
+    errors |= errflToErrors(rawReadRegister(AS5047U_REG::ERRFL::ADDRESS, errors));
+  }
+  return frame & 0x3FFF;
+}
+
+// Asynchronous write: command, data and verify NOP as one begin_transfer() frame list. Like
+// writeRegister(), SPI_16 is promoted to SPI_24 because writes need CRC frames.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::startAsyncWrite(uint16_t address, uint16_t value)
+  requires ASYNC_TRANSFERS
+{
+  if (this->async_state_ != AsyncState::Idle) {
+    return false;
+  }
+  const FrameFormat format =
+      (frameFormat() == FrameFormat::SPI_16) ? FrameFormat::SPI_24 : frameFormat();
+  encodeWriteSequence(format, address, value, this->async_tx_.data());
+  if (!spi_.begin_transfer(this->async_tx_.data(), this->async_rx_.data(), frameLength(format),
+                           3)) {
+    return false;
+  }
+  this->async_address_ = address & 0x3FFF;
+  this->async_expected_ = value & 0x3FFF;
+  this->async_frames_ = 3;
+  this->async_format_ = format;
+  this->async_state_ = AsyncState::WriteInFlight;
+  this->pipeline_address_ = AS5047U_REG::NOP::ADDRESS;
+  return true;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::completeAsyncWrite()
+  requires ASYNC_TRANSFERS
+{
+  if (this->async_state_ != AsyncState::WriteInFlight) {
+    return false;
+  }
+  WaitForTransfer(spi_);
+  this->async_state_ = AsyncState::Idle;
+
+  const std::size_t len = frameLength(this->async_format_);
+  const uint16_t read_back =
+      decodeFrame(this->async_format_, this->async_rx_.data() + (2U * len)) & 0x3FFF;
+  if (read_back == this->async_expected_) {
+    storeConfigCache(this->async_address_, read_back);
+    return true;
+  }
+  dropConfigCache(this->async_address_);
+  sticky_errors_.fetch_or(static_cast<uint16_t>(AS5047U_Error::WriteVerifyFailed));
+  const uint16_t errfl = rawReadRegister(AS5047U_REG::ERRFL::ADDRESS);
+  updateStickyErrors(errfl);
+  LogPolicy::Log(
+      {LogEvent::WriteVerifyFailed, this->async_address_, this->async_expected_, read_back, errfl});
+  return false;
+}
+
+#if AS5047U_HAS_COROUTINES
+// ══════════════════════════════════════════════════════════════════════════════════════════
+//                                 COROUTINE AWAITABLES
+// ══════════════════════════════════════════════════════════════════════════════════════════
+//
+// await_suspend() starts the frame list through begin_transfer() and hands the coroutine to the
+// bus's resume_when_done() executor; await_resume() decodes the finished frames. If the transfer
+// cannot be started, await_suspend() returns false (no suspension) and await_resume() falls back
+// to the blocking path when the driver is idle. When another asynchronous transfer owns the bus
+// nothing runs, and the awaitable reports AS5047U_Error::BusBusy instead of a value.
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+template <typename RegT>
+class AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::ReadAwaitable {
+public:
+  explicit ReadAwaitable(AS5047U& driver) noexcept : driver_(driver) {}
+
+  bool await_ready() const noexcept {
+    return false;
+  }
+
+  bool await_suspend(std::coroutine_handle<> handle) {
+    started_ = driver_.startAsyncRead(RegT::ADDRESS);
+    if (!started_) {
+      return false;
+    }
+    driver_.spi_.resume_when_done(handle);
+    return true;
+  }
+
+  Result<RegT> await_resume() {
+    if (started_) {
+      uint16_t errors = 0;
+      const uint16_t raw = driver_.completeAsyncRead(errors);
+      driver_.mergeStickyErrors(errors);
+      return {decode<RegT>(raw), static_cast<AS5047U_Error>(errors)};
+    }
+    if (driver_.async_state_ == AsyncState::Idle) {
+      return driver_.template ReadRegResult<RegT>();
+    }
+    driver_.mergeStickyErrors(static_cast<uint16_t>(AS5047U_Error::BusBusy));
+    return {RegT{}, AS5047U_Error::BusBusy};
+  }
+
+private:
+  AS5047U& driver_;
+  bool started_{false};
+};
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+template <typename RegT>
+class AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::WriteAwaitable {
+public:
+  WriteAwaitable(AS5047U& driver, const RegT& reg) noexcept : driver_(driver), reg_(reg) {}
+
+  bool await_ready() const noexcept {
+    return false;
+  }
+
+  bool await_suspend(std::coroutine_handle<> handle) {
+    started_ = driver_.startAsyncWrite(RegT::ADDRESS, encode(reg_));
+    if (!started_) {
+      return false;
+    }
+    driver_.spi_.resume_when_done(handle);
+    return true;
+  }
+
+  bool await_resume() {
+    if (started_) {
+      return driver_.completeAsyncWrite();
+    }
+    if (driver_.async_state_ == AsyncState::Idle) {
+      return driver_.WriteReg(reg_);
+    }
+    driver_.mergeStickyErrors(static_cast<uint16_t>(AS5047U_Error::BusBusy));
+    return false;
+  }
+
+private:
+  AS5047U& driver_;
+  RegT reg_;
+  bool started_{false};
+};
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+class AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::AngleAwaitable : public ReadAwaitable<AS5047U_REG::ANGLECOM> {
+public:
+  using ReadAwaitable<AS5047U_REG::ANGLECOM>::ReadAwaitable;
+
+  Result<uint16_t> await_resume()
+    requires COROUTINE_TRANSFERS
+  {
+    const auto reg = ReadAwaitable<AS5047U_REG::ANGLECOM>::await_resume();
+    return {static_cast<uint16_t>(reg.value.bits.ANGLECOM_value), reg.errors};
+  }
+};
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+class AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::VelocityAwaitable : public ReadAwaitable<AS5047U_REG::VEL> {
+public:
+  using ReadAwaitable<AS5047U_REG::VEL>::ReadAwaitable;
+
+  Result<int16_t> await_resume()
+    requires COROUTINE_TRANSFERS
+  {
+    const auto reg = ReadAwaitable<AS5047U_REG::VEL>::await_resume();
+    return {velocityFromRaw(reg.value.bits.VEL_value), reg.errors};
+  }
+};
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::AngleAwaitable AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::AwaitAngle()
+  requires COROUTINE_TRANSFERS
+{
+  return AngleAwaitable(*this);
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+typename AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::VelocityAwaitable AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::AwaitVelocity()
+  requires COROUTINE_TRANSFERS
+{
+  return VelocityAwaitable(*this);
+}
+#endif // AS5047U_HAS_COROUTINES
+
+// Chained read: command k+1 rides in the frame returning response k, so N registers cost N+1
+// frames. In ReadErrfl mode the closing frame is an ERRFL command instead of a NOP, which adds a
+// single extra NOP frame for the whole chain instead of two frames per register. All frames go
+// out as one frame list. The errors of the chain are collected in `errors`.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::readRegisterChain(const uint16_t* addrs, uint16_t* out, std::size_t count,
+                                         uint8_t* tx, uint8_t* rx, uint16_t& errors) const {
+  const BusGuard guard(*this);
+  if (count == 0U) {
+    return;
+  }
+  const bool read_errfl = (this->error_check_mode_ == ErrorCheckMode::ReadErrfl);
+  const std::size_t len = frameLength();
+  const std::size_t frames = count + (read_errfl ? 2U : 1U);
+
+  // Command list: addrs[0..count-1], then NOP (or ERRFL + NOP)
+  for (std::size_t i = 0; i < frames; ++i) {
+    uint16_t addr = AS5047U_REG::NOP::ADDRESS;
+    if (i < count) {
+      addr = addrs[i];
+    } else if (read_errfl && i == count) {
+      addr = AS5047U_REG::ERRFL::ADDRESS;
+    }
+    encodeReadCommand(addr, tx + (i * len));
+  }
+  const uint64_t start = transferStartTime();
+  TransferFrames(spi_, tx, rx, len, frames);
+  recordFrameTimes(start, frames);
+  latchSampleTime(false);
+  this->pipeline_address_ = AS5047U_REG::NOP::ADDRESS;
+
+  uint16_t status = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    const uint16_t frame = decodeResponse(rx + ((i + 1U) * len), errors);
+    status |= frame;
+    out[i] = frame & 0x3FFF;
+    if ((addrs[i] & 0x3FFF) == AS5047U_REG::ERRFL::ADDRESS) {
+      errors |= errflToErrors(out[i]); // ERRFL clears on read
+    }
+  }
+  if (read_errfl) {
+    errors |= errflToErrors(decodeResponse(rx + ((count + 1U) * len), errors) & 0x3FFF);
+  } else if ((status & FRAME_STATUS_MASK) != 0U) {
+    errors |= errflToErrors(rawReadRegister(AS5047U_REG::ERRFL::ADDRESS, errors));
+  }
+  if ((errors & RETRY_ERROR_MASK) == 0U) {
+    for (std::size_t i = 0; i < count; ++i) {
+      storeConfigCache(addrs[i], out[i]);
+    }
+  }
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::readRegisterChain(const uint16_t* addrs, uint16_t* out, std::size_t count,
+                                         uint8_t* tx, uint8_t* rx) const {
+  uint16_t errors = 0;
+  readRegisterChain(addrs, out, count, tx, rx, errors);
+  mergeStickyErrors(errors);
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::writeRegister(uint16_t address, uint16_t value, uint8_t retries,
+                                             WriteVerify verify) const {
+  const BusGuard guard(*this);
+  if (verify != WriteVerify::Immediate) {
+    uint8_t tx[2 * MAX_FRAME_BYTES + MAX_FRAME_BYTES];
+    uint8_t rx[2 * MAX_FRAME_BYTES + MAX_FRAME_BYTES];
+    return writeRegisterChain(&address, &value, 1, retries, verify, tx, rx);
+  }
   bool success = false;
-  uint16_t err_mask = static_cast<uint16_t>(AS5047U_Error::CrcError) |
-                      static_cast<uint16_t>(AS5047U_Error::FramingError);
 
   // The AS5047U datasheet specifies 16-bit frames for read operations only.
   // Writes require 24-bit or 32-bit frames (which include CRC). If the current
   // frame format is SPI_16, temporarily promote to SPI_24 for the write, then
   // restore. This ensures writes always reach the IC correctly.
-  FrameFormat active_format = this->frame_format_;
+  FrameFormat active_format = frameFormat();
   if (active_format == FrameFormat::SPI_16) {
     active_format = FrameFormat::SPI_24;
   }
-
-  // DS Fig.30: Write = command frame then data frame. MISO during data = old content.
-  // "At the next command" MISO = new content — so we send NOP after data and use that MISO to verify.
-  // CS may toggle between command and data frames.
+  const std::size_t len = frameLength(active_format);
   const uint16_t expected = value & 0x3FFF;
-  const uint16_t nop_addr = AS5047U_REG::NOP::ADDRESS;
-  const uint16_t nop_crc_input = static_cast<uint16_t>((1 << 14) | (nop_addr & 0x3FFF));
-  const uint8_t crc_nop = ComputeCRC8(nop_crc_input);
+
+  // Command, data, then NOP (MISO on NOP = new content), sent as one frame list.
+  uint8_t tx[3 * MAX_FRAME_BYTES];
+  uint8_t rx[3 * MAX_FRAME_BYTES];
+  encodeWriteSequence(active_format, address, value, tx);
 
   for (uint8_t attempt = 0; attempt <= retries; ++attempt) {
-    if (active_format == FrameFormat::SPI_24) {
-      // ---- 24-bit write: command, data, then NOP (MISO on NOP = new content) ----
-      uint16_t cmd_payload = static_cast<uint16_t>(address & 0x3FFF);
-      uint8_t cmd_crc = ComputeCRC8(cmd_payload);
-      const uint8_t tx_cmd[3] = {static_cast<uint8_t>((address >> 8) & 0x3F), // bit6=0 for write
-                                 static_cast<uint8_t>(address & 0xFF), cmd_crc};
-      uint8_t rx_cmd[3];
-      spi_.transfer(tx_cmd, rx_cmd, 3);
-
-      uint16_t data_payload = value & 0x3FFF;
-      uint8_t data_crc = ComputeCRC8(data_payload);
-      const uint8_t tx_data[3] = {static_cast<uint8_t>((data_payload >> 8) & 0xFF),
-                                  static_cast<uint8_t>(data_payload & 0xFF), data_crc};
-      uint8_t rx_data[3];
-      spi_.transfer(tx_data, rx_data, 3);  // MISO here = old content (DS Fig.30)
-
-      // NOP — MISO = new content of the written register (third TX = response to write)
-      // 24-bit MISO same layout as 32-bit: Byte0=[ER,Err,Data13:8], Byte1=Data7:0 → 14-bit = (B0&0x3F)<<8|B1
-      const uint8_t tx_nop[3] = {static_cast<uint8_t>(((nop_addr >> 8) & 0x3F) | 0x40),
-                                 static_cast<uint8_t>(nop_addr & 0xFF), crc_nop};
-      uint8_t rx_nop[3];
-      spi_.transfer(tx_nop, rx_nop, 3);
-      uint16_t read_back = (static_cast<uint16_t>(rx_nop[0] & 0x3Fu) << 8) | rx_nop[1];
-      if (read_back == expected) {
-        success = true;
-        break;
+    TransferFrames(spi_, tx, rx, len, 3);
+    this->pipeline_address_ = AS5047U_REG::NOP::ADDRESS;
+    // 24/32-bit MISO: Byte0=[ER,Err,Data13:8], Byte1=Data7:0 -> 14-bit = (B0&0x3F)<<8|B1
+    uint16_t read_back = decodeFrame(active_format, rx + (2U * len)) & 0x3FFF;
+    if (read_back == expected) {
+      success = true;
+      break;
+    }
+    auto errfl = this->template ReadReg<AS5047U_REG::ERRFL>();
+    updateStickyErrors(errfl.value);
+    LogPolicy::Log({LogEvent::WriteVerifyFailed, static_cast<uint16_t>(address & 0x3FFF), expected,
+                    read_back, errfl.value});
+  }
+  if (success) {
+    storeConfigCache(address, expected);
+  } else {
+    dropConfigCache(address); // device content unknown after a failed write
+    sticky_errors_.fetch_or(static_cast<uint16_t>(AS5047U_Error::WriteVerifyFailed));
+  }
+  return success;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::WriteRegs(std::span<const RegisterWrite> writes, uint8_t retries) {
+  std::array<uint16_t, WRITE_CHAIN_LENGTH> addrs{};
+  std::array<uint16_t, WRITE_CHAIN_LENGTH> values{};
+  std::array<uint8_t, ((2U * WRITE_CHAIN_LENGTH) + 1U) * MAX_FRAME_BYTES> tx{};
+  std::array<uint8_t, ((2U * WRITE_CHAIN_LENGTH) + 1U) * MAX_FRAME_BYTES> rx{};
+  bool success = true;
+  for (std::size_t first = 0; first < writes.size(); first += WRITE_CHAIN_LENGTH) {
+    const std::size_t count = std::min(WRITE_CHAIN_LENGTH, writes.size() - first);
+    for (std::size_t i = 0; i < count; ++i) {
+      addrs[i] = writes[first + i].address;
+      values[i] = writes[first + i].value;
+    }
+    success = writeRegisterChain(addrs.data(), values.data(), count, retries, this->write_verify_,
+                                 tx.data(), rx.data()) &&
+              success;
+  }
+  return success;
+}
+
+// Chained write (DS Fig.30): the frame after a data frame returns the register's new content, so
+// write k is verified by the command frame of write k+1 and only the last write needs a NOP:
+// cmd0, data0, cmd1, data1, ..., dataN-1, NOP = 2N+1 frames instead of 3N. Mismatches cost one
+// ERRFL read per attempt; a retry resends the whole chain. Without immediate verify the closing
+// NOP is left off (2N frames): the cache takes the written values on trust and Deferred queues
+// them for verifyDeferredWrites().
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::writeRegisterChain(const uint16_t* addrs, const uint16_t* values,
+                                                  std::size_t count, uint8_t retries,
+                                                  WriteVerify verify, uint8_t* tx,
+                                                  uint8_t* rx) const {
+  const BusGuard guard(*this);
+  if (count == 0U) {
+    return true;
+  }
+  FrameFormat format = frameFormat();
+  if (format == FrameFormat::SPI_16) {
+    format = FrameFormat::SPI_24; // writes need CRC frames, as in writeRegister()
+  }
+  const std::size_t len = frameLength(format);
+  for (std::size_t i = 0; i < count; ++i) {
+    // Each sequence's trailing NOP is overwritten by the next command, except the last one
+    encodeWriteSequence(format, addrs[i], values[i], tx + (2U * i * len));
+  }
+
+  if (verify != WriteVerify::Immediate) {
+    TransferFrames(spi_, tx, rx, len, 2U * count);
+    // Without a read-back the responses to the command and data frames are all there is: their
+    // CRC and status bits (and ERRFL if a status bit is set) go into the sticky flags.
+    uint16_t errors = 0;
+    uint16_t status = 0;
+    for (std::size_t i = 0; i < 2U * count; ++i) {
+      status |= decodeFrame(format, rx + (i * len), errors);
+    }
+    if ((status & FRAME_STATUS_MASK) != 0U) {
+      errors |= errflToErrors(rawReadRegister(AS5047U_REG::ERRFL::ADDRESS, errors));
+    }
+    mergeStickyErrors(errors);
+    this->pipeline_address_ = NO_PENDING_READ; // in flight: new content of addrs[count - 1]
+    const bool flagged = (errors != 0U);
+    for (std::size_t i = 0; i < count; ++i) {
+      if (flagged) {
+        dropConfigCache(addrs[i]); // the cache is only filled on trust for a clean exchange
+      } else {
+        storeConfigCache(addrs[i], values[i]);
       }
-      auto errfl = this->template ReadReg<AS5047U_REG::ERRFL>();
-      updateStickyErrors(errfl.value);
-      printf("AS5047U write verify failed: addr=0x%04X expected=0x%04X read_back=0x%04X "
-             "ERRFL=0x%04X (CRC_error=%u Framing_error=%u Command_error=%u)\n",
-             static_cast<unsigned>(address), static_cast<unsigned>(expected),
-             static_cast<unsigned>(read_back), static_cast<unsigned>(errfl.value),
-             static_cast<unsigned>(errfl.bits.CRC_error),
-             static_cast<unsigned>(errfl.bits.Framing_error),
-             static_cast<unsigned>(errfl.bits.Command_error));
-    } else if (active_format == FrameFormat::SPI_32) {
-      // ---- 32-bit write: command, data, then NOP (MISO on NOP = new content) ----
-      uint16_t cmd_payload = static_cast<uint16_t>(address & 0x3FFF);
-      uint8_t cmd_crc = ComputeCRC8(cmd_payload);
-      const uint8_t tx_cmd[4] = {this->pad_byte_,
-                                 static_cast<uint8_t>((address >> 8) & 0x3F), // bit6=0 for write
-                                 static_cast<uint8_t>(address & 0xFF), cmd_crc};
-      uint8_t rx_cmd[4];
-      spi_.transfer(tx_cmd, rx_cmd, 4);
-
-      uint16_t data_payload = value & 0x3FFF;
-      uint8_t data_crc = ComputeCRC8(data_payload);
-      const uint8_t tx_data[4] = {this->pad_byte_, static_cast<uint8_t>((data_payload >> 8) & 0xFF),
-                                  static_cast<uint8_t>(data_payload & 0xFF), data_crc};
-      uint8_t rx_data[4];
-      spi_.transfer(tx_data, rx_data, 4);  // MISO here = old content (DS Fig.30)
-
-      // NOP — MISO = new content (Fig.28: Byte0/1 = Data, Byte2 = CRC, Byte3 = PAD)
-      const uint8_t tx_nop[4] = {this->pad_byte_,
-                                static_cast<uint8_t>(((nop_addr >> 8) & 0x3F) | 0x40),
-                                static_cast<uint8_t>(nop_addr & 0xFF), crc_nop};
-      uint8_t rx_nop[4];
-      spi_.transfer(tx_nop, rx_nop, 4);
-      uint16_t read_back = (static_cast<uint16_t>(rx_nop[0] & 0x3Fu) << 8) | rx_nop[1];
+      if (verify == WriteVerify::Deferred) {
+        queueDeferredVerify(addrs[i], values[i]);
+      }
+    }
+    return true;
+  }
+
+  bool success = false;
+  for (uint8_t attempt = 0; attempt <= retries && !success; ++attempt) {
+    TransferFrames(spi_, tx, rx, len, (2U * count) + 1U);
+    this->pipeline_address_ = AS5047U_REG::NOP::ADDRESS;
+    success = true;
+    LogRecord first_failure{};
+    for (std::size_t i = 0; i < count; ++i) {
+      const uint16_t read_back = decodeFrame(format, rx + (((2U * i) + 2U) * len)) & 0x3FFF;
+      const auto expected = static_cast<uint16_t>(values[i] & 0x3FFF);
       if (read_back == expected) {
-        success = true;
-        break;
+        storeConfigCache(addrs[i], read_back);
+      } else {
+        dropConfigCache(addrs[i]);
+        if (success) {
+          first_failure = {LogEvent::WriteVerifyFailed, static_cast<uint16_t>(addrs[i] & 0x3FFF),
+                           expected, read_back, 0};
+        }
+        success = false;
       }
-      auto errfl = this->template ReadReg<AS5047U_REG::ERRFL>();
-      updateStickyErrors(errfl.value);
-      printf("AS5047U write verify failed: addr=0x%04X expected=0x%04X read_back=0x%04X "
-             "ERRFL=0x%04X (CRC_error=%u Framing_error=%u Command_error=%u)\n",
-             static_cast<unsigned>(address), static_cast<unsigned>(expected),
-             static_cast<unsigned>(read_back), static_cast<unsigned>(errfl.value),
-             static_cast<unsigned>(errfl.bits.CRC_error),
-             static_cast<unsigned>(errfl.bits.Framing_error),
-             static_cast<unsigned>(errfl.bits.Command_error));
     }
+    if (!success) {
+      first_failure.errfl = rawReadRegister(AS5047U_REG::ERRFL::ADDRESS);
+      updateStickyErrors(first_failure.errfl);
+      LogPolicy::Log(first_failure); // one record per failed chain
+    }
+  }
+  if (!success) {
+    sticky_errors_.fetch_or(static_cast<uint16_t>(AS5047U_Error::WriteVerifyFailed));
+  }
+  return success;
+}
+
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::queueDeferredVerify(uint16_t address, uint16_t value) const {
+  const BusGuard guard(*this);
+  const auto addr = static_cast<uint16_t>(address & 0x3FFF);
+  const auto expected = static_cast<uint16_t>(value & 0x3FFF);
+  for (std::size_t i = 0; i < this->deferred_count_; ++i) {
+    if (this->deferred_writes_[i].address == addr) {
+      this->deferred_writes_[i].value = expected; // only the last value can be read back
+      return;
+    }
+  }
+  if (this->deferred_count_ == DEFERRED_VERIFY_CAPACITY) {
+    verifyDeferredWrites();
+  }
+  this->deferred_writes_[this->deferred_count_++] = {addr, expected};
+}
+
+// Deferred verification: one chained read of every queued register. A mismatch flags
+// WriteVerifyFailed and drops the cache entry, which was filled on trust when the write went out.
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::verifyDeferredWrites() const {
+  const BusGuard guard(*this);
+  const std::size_t count = this->deferred_count_;
+  if (count == 0U) {
+    return true;
+  }
+  this->deferred_count_ = 0;
+  std::array<uint16_t, DEFERRED_VERIFY_CAPACITY> addrs{};
+  std::array<uint16_t, DEFERRED_VERIFY_CAPACITY> raw{};
+  std::array<uint8_t, (DEFERRED_VERIFY_CAPACITY + 2U) * MAX_FRAME_BYTES> tx{};
+  std::array<uint8_t, (DEFERRED_VERIFY_CAPACITY + 2U) * MAX_FRAME_BYTES> rx{};
+  for (std::size_t i = 0; i < count; ++i) {
+    addrs[i] = this->deferred_writes_[i].address;
+  }
+  readRegisterChain(addrs.data(), raw.data(), count, tx.data(), rx.data());
+  bool success = true;
+  for (std::size_t i = 0; i < count; ++i) {
+    if (raw[i] != this->deferred_writes_[i].value) {
+      dropConfigCache(addrs[i]);
+      LogPolicy::Log(
+          {LogEvent::DeferredVerifyFailed, addrs[i], this->deferred_writes_[i].value, raw[i], 0});
+      success = false;
+    }
+  }
+  if (!success) {
+    sticky_errors_.fetch_or(static_cast<uint16_t>(AS5047U_Error::WriteVerifyFailed));
   }
   return success;
 }
@@ -706,8 +1754,8 @@ bool AS5047U<SpiType>::writeRegister(uint16_t address, uint16_t value, uint8_t r
 // ════════════════════════════════════════════════════════════════════════════════════════════
 
 // Complete dumpStatus with full register dump
-template <typename SpiType>
-void AS5047U<SpiType>::DumpStatus() const {
+template <typename SpiType, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047U<SpiType, Format, LogPolicy, Concurrency, ClockPolicy>::DumpStatus() const {
   printf("\n=== AS5047U Comprehensive Status ===\n");
   // Core measurements
   printf("Angle (COM) : %u\n", GetAngle());
@@ -758,7 +1806,7 @@ void AS5047U<SpiType>::DumpStatus() const {
   printf("PROG(0x0003): PROGEN=%u PROGOTP=%u OTPREF=%u PROGVER=%u\n", prog.bits.PROGEN,
          prog.bits.PROGOTP, prog.bits.OTPREF, prog.bits.PROGVER);
   // Interface settings
-  printf("FrameFormat      : %u  PadByte=0x%02X\n", static_cast<uint8_t>(this->frame_format_),
+  printf("FrameFormat      : %u  PadByte=0x%02X\n", static_cast<uint8_t>(frameFormat()),
          this->pad_byte_);
   printf("========================================\n\n");
 }
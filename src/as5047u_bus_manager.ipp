@@ -0,0 +1,46 @@
+/**
+ * @file as5047u_bus_manager.ipp
+ * @brief Template implementation of the AS5047U shared-bus manager
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ */
+#ifndef AS5047U_BUS_MANAGER_IMPL
+#define AS5047U_BUS_MANAGER_IMPL
+
+#include "../inc/as5047u_bus_manager.hpp"
+
+namespace as5047u {
+
+// Back-to-back schedule: with async buses every encoder's command frame is queued before the
+// first one is collected, so the peripheral never idles between chip selects. Encoders whose
+// queue is busy fall back to a blocking pipelined read.
+template <typename SpiType, std::size_t N, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+template <typename RegT>
+void AS5047UBusManager<SpiType, N, Format, LogPolicy, Concurrency, ClockPolicy>::ReadAll(std::array<RegT, N>& out) {
+  if constexpr (Encoder::ASYNC_TRANSFERS) {
+    std::array<bool, N> started{};
+    for (std::size_t i = 0; i < N; ++i) {
+      started[i] = encoders_[i].template StartAsyncReadContinuous<RegT>();
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+      out[i] = started[i] ? encoders_[i].template CompleteAsyncRead<RegT>()
+                          : encoders_[i].template ReadRegContinuous<RegT>();
+    }
+  } else {
+    for (std::size_t i = 0; i < N; ++i) {
+      out[i] = encoders_[i].template ReadRegContinuous<RegT>();
+    }
+  }
+}
+
+template <typename SpiType, std::size_t N, auto Format, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047UBusManager<SpiType, N, Format, LogPolicy, Concurrency, ClockPolicy>::ReadAngles(std::array<uint16_t, N>& out) {
+  std::array<AS5047U_REG::ANGLECOM, N> regs{};
+  ReadAll(regs);
+  for (std::size_t i = 0; i < N; ++i) {
+    out[i] = regs[i].bits.ANGLECOM_value;
+  }
+}
+
+} // namespace as5047u
+
+#endif // AS5047U_BUS_MANAGER_IMPL
@@ -0,0 +1,229 @@
+/**
+ * @file as5047u_daisy_chain.ipp
+ * @brief Template implementation of the AS5047U daisy-chain driver
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ */
+#ifndef AS5047U_DAISY_CHAIN_IMPL
+#define AS5047U_DAISY_CHAIN_IMPL
+
+#include "../inc/as5047u_daisy_chain.hpp"
+
+namespace as5047u {
+
+template <typename SpiType, std::size_t N, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+AS5047UDaisyChain<SpiType, N, LogPolicy, Concurrency, ClockPolicy>::AS5047UDaisyChain(SpiType& bus) noexcept : spi_(bus) {}
+
+// ══════════════════════════════════════════════════════════════════════════════════════════
+// CHAIN READS
+// ══════════════════════════════════════════════════════════════════════════════════════════
+
+template <typename SpiType, std::size_t N, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+template <typename RegT>
+bool AS5047UDaisyChain<SpiType, N, LogPolicy, Concurrency, ClockPolicy>::ReadAll(std::array<RegT, N>& out) {
+  ChainGuard guard(*this);
+  if constexpr (ClockPolicy::ENABLED) {
+    times_.sample = clockNow();
+  }
+  // Cycle 1: read command in every slot (responses belong to the previous access)
+  loadCommand(COMMAND_FRAMES_OF<RegT>.read[SPI_32_IMAGE]);
+  spi_.transfer(tx_.data(), rx_.data(), CHAIN_BYTES);
+  // Cycle 2: NOP in every slot; each device now returns its RegT content
+  loadCommand(COMMAND_FRAMES_OF<AS5047U_REG::NOP>.read[SPI_32_IMAGE]);
+  std::array<uint16_t, N> frames{};
+  const bool ok = transferAndDemux(frames.data());
+  this->pipeline_address_ = AS5047U_REG::NOP::ADDRESS;
+  refreshErrors(frames.data(), false);
+  for (std::size_t d = 0; d < N; ++d) {
+    out[d].value = static_cast<uint16_t>(frames[d] & 0x3FFF);
+  }
+  return ok;
+}
+
+template <typename SpiType, std::size_t N, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+template <typename RegT>
+bool AS5047UDaisyChain<SpiType, N, LogPolicy, Concurrency, ClockPolicy>::ReadAllContinuous(std::array<RegT, N>& out) {
+  ChainGuard guard(*this);
+  loadCommand(COMMAND_FRAMES_OF<RegT>.read[SPI_32_IMAGE]);
+  if (this->pipeline_address_ != RegT::ADDRESS) {
+    // Priming cycle: put the RegT command in flight
+    if constexpr (ClockPolicy::ENABLED) {
+      times_.pipeline = clockNow();
+    }
+    spi_.transfer(tx_.data(), rx_.data(), CHAIN_BYTES);
+  }
+  // The values returned now were sampled at the cycle that sent the command in flight
+  if constexpr (ClockPolicy::ENABLED) {
+    times_.sample = times_.pipeline;
+    times_.pipeline = clockNow();
+  }
+  std::array<uint16_t, N> frames{};
+  const bool ok = transferAndDemux(frames.data());
+  this->pipeline_address_ = RegT::ADDRESS;
+  refreshErrors(frames.data(), false);
+  for (std::size_t d = 0; d < N; ++d) {
+    out[d].value = static_cast<uint16_t>(frames[d] & 0x3FFF);
+  }
+  return ok;
+}
+
+template <typename SpiType, std::size_t N, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047UDaisyChain<SpiType, N, LogPolicy, Concurrency, ClockPolicy>::ReadAngles(std::array<uint16_t, N>& out) {
+  std::array<AS5047U_REG::ANGLECOM, N> regs{};
+  const bool ok = ReadAllContinuous(regs);
+  for (std::size_t d = 0; d < N; ++d) {
+    out[d] = regs[d].value;
+  }
+  return ok;
+}
+
+// ══════════════════════════════════════════════════════════════════════════════════════════
+// CHAIN WRITES
+// ══════════════════════════════════════════════════════════════════════════════════════════
+
+// DS Fig.30 per device: command cycle, data cycle (MISO = old content), then a NOP cycle whose
+// responses carry the new content and verify the write of every device at once.
+template <typename SpiType, std::size_t N, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+template <typename RegT>
+bool AS5047UDaisyChain<SpiType, N, LogPolicy, Concurrency, ClockPolicy>::WriteAll(const std::array<RegT, N>& regs) {
+  ChainGuard guard(*this);
+  std::array<uint16_t, N> values{};
+  for (std::size_t d = 0; d < N; ++d) {
+    values[d] = static_cast<uint16_t>(regs[d].value & 0x3FFF);
+  }
+  loadCommand(COMMAND_FRAMES_OF<RegT>.write[SPI_32_IMAGE]);
+  spi_.transfer(tx_.data(), rx_.data(), CHAIN_BYTES);
+  loadData(values.data());
+  spi_.transfer(tx_.data(), rx_.data(), CHAIN_BYTES);
+  loadCommand(COMMAND_FRAMES_OF<AS5047U_REG::NOP>.read[SPI_32_IMAGE]);
+  std::array<uint16_t, N> frames{};
+  bool ok = transferAndDemux(frames.data());
+  this->pipeline_address_ = AS5047U_REG::NOP::ADDRESS;
+  for (std::size_t d = 0; d < N; ++d) {
+    if ((frames[d] & 0x3FFF) != values[d]) {
+      sticky_errors_[d].fetch_or(static_cast<uint16_t>(AS5047U_Error::WriteVerifyFailed));
+      ok = false;
+    }
+  }
+  const std::array<uint16_t, N> errfl = refreshErrors(frames.data(), !ok);
+  if (!ok) {
+    for (std::size_t d = 0; d < N; ++d) {
+      if ((frames[d] & 0x3FFF) != values[d]) {
+        LogPolicy::Log(LogRecord{LogEvent::WriteVerifyFailed, RegT::ADDRESS, values[d],
+                                 static_cast<uint16_t>(frames[d] & 0x3FFF), errfl[d]});
+      }
+    }
+  }
+  return ok;
+}
+
+template <typename SpiType, std::size_t N, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+template <typename RegT>
+bool AS5047UDaisyChain<SpiType, N, LogPolicy, Concurrency, ClockPolicy>::WriteAll(const RegT& reg) {
+  std::array<RegT, N> regs;
+  regs.fill(reg);
+  return WriteAll(regs);
+}
+
+template <typename SpiType, std::size_t N, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+AS5047U_Error AS5047UDaisyChain<SpiType, N, LogPolicy, Concurrency, ClockPolicy>::GetStickyErrorFlags(std::size_t device) {
+  if (device >= N) {
+    return AS5047U_Error::None;
+  }
+  return static_cast<AS5047U_Error>(sticky_errors_[device].exchange(0));
+}
+
+// ══════════════════════════════════════════════════════════════════════════════════════════
+// FRAME ASSEMBLY AND DEMULTIPLEXING
+// ══════════════════════════════════════════════════════════════════════════════════════════
+
+template <typename SpiType, std::size_t N, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047UDaisyChain<SpiType, N, LogPolicy, Concurrency, ClockPolicy>::loadCommand(const FrameImage& image) noexcept {
+  for (std::size_t slot = 0; slot < N; ++slot) {
+    uint8_t* frame = tx_.data() + (slot * FRAME_BYTES);
+    frame[0] = static_cast<uint8_t>(slot); // pad = slot index, echoed on MISO byte 3
+    frame[1] = image[1];
+    frame[2] = image[2];
+    frame[3] = image[3];
+  }
+}
+
+template <typename SpiType, std::size_t N, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+void AS5047UDaisyChain<SpiType, N, LogPolicy, Concurrency, ClockPolicy>::loadData(const uint16_t* values) noexcept {
+  std::array<uint8_t, N> crcs{};
+  Crc8Batch(values, crcs.data(), N);
+  for (std::size_t slot = 0; slot < N; ++slot) {
+    uint8_t* frame = tx_.data() + (slot * FRAME_BYTES);
+    frame[0] = static_cast<uint8_t>(slot);
+    frame[1] = static_cast<uint8_t>(values[slot] >> 8);
+    frame[2] = static_cast<uint8_t>(values[slot] & 0xFF);
+    frame[3] = crcs[slot];
+  }
+}
+
+// One CS cycle. MISO slot j = [ER,Err,D13:8], D7:0, CRC, PAD; PAD names the device. All N CRCs
+// are verified in one batch. Devices that are missing, duplicated or fail CRC get
+// ResponseCrcError and make the call return false.
+template <typename SpiType, std::size_t N, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+bool AS5047UDaisyChain<SpiType, N, LogPolicy, Concurrency, ClockPolicy>::transferAndDemux(uint16_t* frames) {
+  spi_.transfer(tx_.data(), rx_.data(), CHAIN_BYTES);
+
+  std::array<uint16_t, N> words{};
+  std::array<uint8_t, N> crcs{};
+  std::array<uint8_t, N> mismatch{};
+  for (std::size_t slot = 0; slot < N; ++slot) {
+    const uint8_t* frame = rx_.data() + (slot * FRAME_BYTES);
+    words[slot] = static_cast<uint16_t>((static_cast<uint16_t>(frame[0]) << 8) | frame[1]);
+    crcs[slot] = frame[2];
+  }
+  bool ok = Crc8VerifyBatch(words.data(), crcs.data(), N, mismatch.data()) == 0U;
+
+  std::array<bool, N> seen{};
+  for (std::size_t slot = 0; slot < N; ++slot) {
+    const uint8_t device = rx_[(slot * FRAME_BYTES) + 3];
+    if (device >= N || seen[device]) {
+      ok = false;
+      continue;
+    }
+    seen[device] = true;
+    frames[device] = words[slot];
+    if (mismatch[slot] != 0U) {
+      sticky_errors_[device].fetch_or(static_cast<uint16_t>(AS5047U_Error::ResponseCrcError));
+    }
+  }
+  for (std::size_t d = 0; d < N; ++d) {
+    if (!seen[d]) {
+      frames[d] = 0;
+      sticky_errors_[d].fetch_or(static_cast<uint16_t>(AS5047U_Error::ResponseCrcError));
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+// In-frame error tracking for the whole chain: if any device set a status bit (or a write
+// failed to verify), read ERRFL from all devices in one command + NOP pair. The caller holds
+// the chain lock.
+template <typename SpiType, std::size_t N, typename LogPolicy, typename Concurrency, typename ClockPolicy>
+std::array<uint16_t, N> AS5047UDaisyChain<SpiType, N, LogPolicy, Concurrency, ClockPolicy>::refreshErrors(const uint16_t* frames, bool force) {
+  bool any = force;
+  for (std::size_t d = 0; d < N && !any; ++d) {
+    any = (frames[d] & FRAME_STATUS_MASK) != 0U;
+  }
+  std::array<uint16_t, N> errfl{};
+  if (!any) {
+    return errfl;
+  }
+  loadCommand(COMMAND_FRAMES_OF<AS5047U_REG::ERRFL>.read[SPI_32_IMAGE]);
+  spi_.transfer(tx_.data(), rx_.data(), CHAIN_BYTES);
+  loadCommand(COMMAND_FRAMES_OF<AS5047U_REG::NOP>.read[SPI_32_IMAGE]);
+  transferAndDemux(errfl.data());
+  this->pipeline_address_ = AS5047U_REG::NOP::ADDRESS;
+  for (std::size_t d = 0; d < N; ++d) {
+    sticky_errors_[d].fetch_or(static_cast<uint16_t>(errfl[d] & ERRFL_STICKY_MASK));
+  }
+  return errfl;
+}
+
+} // namespace as5047u
+
+#endif // AS5047U_DAISY_CHAIN_IMPL
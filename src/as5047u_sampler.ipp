@@ -0,0 +1,84 @@
+/**
+ * @file as5047u_sampler.ipp
+ * @brief Template implementation of the AS5047U fixed-rate sampler
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ */
+#ifndef AS5047U_SAMPLER_IMPL
+#define AS5047U_SAMPLER_IMPL
+
+#include "../inc/as5047u_sampler.hpp"
+
+namespace as5047u {
+
+template <typename Driver, std::size_t Capacity>
+AS5047USampler<Driver, Capacity>::AS5047USampler(const Driver& driver,
+                                                 std::chrono::microseconds period) noexcept
+    : driver_(driver), period_(period) {}
+
+template <typename Driver, std::size_t Capacity>
+AS5047USampler<Driver, Capacity>::~AS5047USampler() {
+  Stop();
+}
+
+template <typename Driver, std::size_t Capacity>
+bool AS5047USampler<Driver, Capacity>::Start() {
+  if (this->period_.count() <= 0 || this->thread_.joinable()) {
+    return false;
+  }
+  this->running_.store(true, std::memory_order_release);
+  this->thread_ = std::thread([this] { run(); });
+  return true;
+}
+
+template <typename Driver, std::size_t Capacity>
+void AS5047USampler<Driver, Capacity>::Stop() {
+  this->running_.store(false, std::memory_order_release);
+  if (this->thread_.joinable()) {
+    this->thread_.join();
+  }
+}
+
+template <typename Driver, std::size_t Capacity>
+bool AS5047USampler<Driver, Capacity>::SetPeriod(std::chrono::microseconds period) noexcept {
+  if (this->thread_.joinable()) {
+    return false;
+  }
+  this->period_ = period;
+  return true;
+}
+
+template <typename Driver, std::size_t Capacity>
+EncoderSample AS5047USampler<Driver, Capacity>::Step() {
+  EncoderSample sample = this->driver_.ReadSample();
+  if constexpr (!Driver::Clock::ENABLED) {
+    sample.timestamp = NowMicros(); // no clock policy on the driver: stamp after the read
+  }
+  this->ring_.Push(sample);
+  if (this->snapshot_ != nullptr) {
+    this->snapshot_->Publish(sample);
+  }
+  return sample;
+}
+
+// Absolute schedule: deadline k = start + k * period, so the period does not drift with the
+// time spent reading. A late acquisition skips the deadlines it missed instead of catching up
+// with a burst of back-to-back reads.
+template <typename Driver, std::size_t Capacity>
+void AS5047USampler<Driver, Capacity>::run() {
+  auto deadline = Clock::now();
+  while (this->running_.load(std::memory_order_acquire)) {
+    Step();
+    deadline += this->period_;
+    const auto now = Clock::now();
+    if (now >= deadline) {
+      const auto missed = ((now - deadline) / this->period_) + 1;
+      this->overruns_.fetch_add(static_cast<uint32_t>(missed), std::memory_order_relaxed);
+      deadline += this->period_ * missed;
+    }
+    std::this_thread::sleep_until(deadline);
+  }
+}
+
+} // namespace as5047u
+
+#endif // AS5047U_SAMPLER_IMPL
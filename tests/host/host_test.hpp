@@ -0,0 +1,44 @@
+/**
+ * @file host_test.hpp
+ * @brief Minimal check macros for the host-side tests (no framework dependency)
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ *
+ * Each test executable runs its checks from main() and returns
+ * HostTestResult(), so ctest sees a failure as a non-zero exit code. A failed
+ * check prints its location and keeps going, so one run reports every failure.
+ */
+#pragma once
+#include <cstdio>
+
+inline int g_host_test_failures = 0; ///< failed checks in this executable
+
+/// Record a failure (with file, line and expression) if @p cond is false.
+#define HOST_CHECK(cond)                                                                  \
+  do {                                                                                    \
+    if (!(cond)) {                                                                        \
+      std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);        \
+      ++g_host_test_failures;                                                             \
+    }                                                                                     \
+  } while (0)
+
+/// Like HOST_CHECK(), printing both values of an integer comparison on failure.
+#define HOST_CHECK_EQ(actual, expected)                                                   \
+  do {                                                                                    \
+    const long long host_actual_ = static_cast<long long>(actual);                        \
+    const long long host_expected_ = static_cast<long long>(expected);                    \
+    if (host_actual_ != host_expected_) {                                                 \
+      std::fprintf(stderr, "%s:%d: %s == %lld, expected %lld\n", __FILE__, __LINE__,      \
+                   #actual, host_actual_, host_expected_);                                \
+      ++g_host_test_failures;                                                             \
+    }                                                                                     \
+  } while (0)
+
+/** @brief Print the summary line and return the process exit code. */
+inline int HostTestResult(const char* suite) {
+  if (g_host_test_failures != 0) {
+    std::printf("%s: %d check(s) FAILED\n", suite, g_host_test_failures);
+    return 1;
+  }
+  std::printf("%s: all checks passed\n", suite);
+  return 0;
+}
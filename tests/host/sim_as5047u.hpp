@@ -0,0 +1,149 @@
+/**
+ * @file sim_as5047u.hpp
+ * @brief Behavioural AS5047U model and SPI bus for host-side tests
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ *
+ * SimAs5047u follows the SPI protocol of the datasheet closely enough to run
+ * the driver against it:
+ * - The response to a read command comes in the next frame.
+ * - A write is a command frame followed by a data frame. MISO carries the old
+ *   content during the data frame and the new content in the frame after it.
+ * - 24/32-bit frames carry CRC8. A MOSI CRC mismatch sets ERRFL CrcError.
+ * - A non-zero ERRFL sets the error bit of every MISO word, and reading ERRFL
+ *   clears it.
+ *
+ * SimBus counts bus calls and frames and provides the frame-list hook
+ * (transfer_frames), so a test can check how many frames a driver call costs.
+ */
+#pragma once
+#include "as5047u_crc.hpp"
+#include "as5047u_spi_interface.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace as5047u::test {
+
+/** @brief One simulated AS5047U (register file and frame state machine). */
+class SimAs5047u {
+public:
+  static constexpr uint16_t ERRFL = 0x0001;
+  static constexpr uint16_t ERRFL_CRC_ERROR = 1U << 6;
+
+  /// Register content by 14-bit address.
+  uint16_t& Reg(uint16_t address) noexcept {
+    return regs_[address & 0x3FFF];
+  }
+
+  /// ERRFL bits reported (and cleared) by the next ERRFL read.
+  uint16_t errfl{0};
+  /// Set the warning bit in every MISO word.
+  bool warning{false};
+  /// Index of a frame whose MISO CRC is corrupted (-1: none).
+  long corrupt_frame{-1};
+  /// Frames clocked so far.
+  long frames{0};
+
+  /**
+   * @brief Clock one frame.
+   * @param tx  MOSI bytes (len bytes)
+   * @param rx  MISO bytes (len bytes)
+   * @param len 2, 3 or 4 (SPI_16 / SPI_24 / SPI_32)
+   */
+  void Frame(const uint8_t* tx, uint8_t* rx, std::size_t len) noexcept {
+    uint8_t pad = 0;
+    const uint8_t* mosi = tx;
+    if (len == 4) {
+      pad = tx[0]; // 32-bit frames carry the pad byte first on MOSI and last on MISO
+      mosi = tx + 1;
+    }
+    const auto word = static_cast<uint16_t>((mosi[0] << 8) | mosi[1]);
+    if (len >= 3 && Crc8Bitwise(word) != mosi[2]) {
+      errfl |= ERRFL_CRC_ERROR;
+    }
+
+    uint16_t data = 0;
+    bool data_frame = false;
+    switch (state_) {
+      case State::Read:
+      case State::WriteDone:
+        data = get(address_);
+        break;
+      case State::WriteCommand:
+        data = get(address_);
+        regs_[address_] = word & 0x3FFF;
+        data_frame = true;
+        break;
+      case State::Idle:
+        break;
+    }
+
+    auto miso = static_cast<uint16_t>(data & 0x3FFF);
+    if (errfl != 0U) {
+      miso |= 0x4000;
+    }
+    if (warning) {
+      miso |= 0x8000;
+    }
+    rx[0] = static_cast<uint8_t>(miso >> 8);
+    rx[1] = static_cast<uint8_t>(miso & 0xFF);
+    if (len >= 3) {
+      uint8_t crc = Crc8Bitwise(miso);
+      if (frames == corrupt_frame) {
+        crc ^= 0x5A;
+      }
+      rx[2] = crc;
+    }
+    if (len == 4) {
+      rx[3] = pad;
+    }
+
+    if (data_frame) {
+      state_ = State::WriteDone;
+    } else {
+      state_ = (word & 0x4000) != 0U ? State::Read : State::WriteCommand;
+      address_ = word & 0x3FFF;
+    }
+    ++frames;
+  }
+
+private:
+  enum class State : uint8_t { Idle, Read, WriteCommand, WriteDone };
+
+  uint16_t get(uint16_t address) noexcept {
+    if (address == ERRFL) {
+      const uint16_t value = errfl;
+      errfl = 0;
+      return value;
+    }
+    return regs_[address];
+  }
+
+  std::array<uint16_t, 0x4000> regs_{};
+  State state_{State::Idle};
+  uint16_t address_{0};
+};
+
+/** @brief Single-device bus with the frame-list hook. */
+class SimBus : public SpiInterface<SimBus> {
+public:
+  SimAs5047u device;
+  long calls{0}; ///< transfer() and transfer_frames() calls
+
+  void transfer(const uint8_t* tx, uint8_t* rx, std::size_t len) {
+    ++calls;
+    std::array<uint8_t, 4> unused{};
+    device.Frame(tx, rx != nullptr ? rx : unused.data(), len);
+  }
+
+  void transfer_frames(const uint8_t* tx, uint8_t* rx, std::size_t frame_len, std::size_t count) {
+    ++calls;
+    std::array<uint8_t, 4> unused{};
+    for (std::size_t i = 0; i < count; ++i) {
+      device.Frame(tx + (i * frame_len), rx != nullptr ? rx + (i * frame_len) : unused.data(),
+                   frame_len);
+    }
+  }
+};
+
+} // namespace as5047u::test
@@ -0,0 +1,125 @@
+/**
+ * @file test_crc.cpp
+ * @brief Host checks of every CRC8 path against the bit-serial reference
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ *
+ * Crc8(), Crc8Batch() and Crc8VerifyBatch() must agree with Crc8Bitwise() for
+ * all 65536 frame words. The build compiles this file once per batch backend
+ * the compiler can target (scalar, SSSE3, AVX2), so each SIMD path is checked
+ * as well as the one the default flags select.
+ */
+#include "as5047u_crc.hpp"
+#include "host_test.hpp"
+#include <cstdio>
+#include <vector>
+
+using namespace as5047u;
+
+namespace {
+
+constexpr std::size_t ALL_WORDS = 0x10000;
+
+std::vector<uint16_t> allWords() {
+  std::vector<uint16_t> words(ALL_WORDS);
+  for (std::size_t i = 0; i < ALL_WORDS; ++i) {
+    words[i] = static_cast<uint16_t>(i);
+  }
+  return words;
+}
+
+/// Pinned CRCs of common command words, so a change to the reference itself is caught too.
+void checkKnownFrames() {
+  HOST_CHECK_EQ(Crc8Bitwise(0x4000), 0x1B); // NOP read
+  HOST_CHECK_EQ(Crc8Bitwise(0x4001), 0x06); // ERRFL read
+  HOST_CHECK_EQ(Crc8Bitwise(0x7FFF), 0xBD); // ANGLECOM read
+  HOST_CHECK_EQ(Crc8Bitwise(0x0016), 0x72); // ZPOSM write command
+  HOST_CHECK_EQ(Crc8Bitwise(0x0071), 0xB5); // SETTINGS2 data 0x71
+}
+
+void checkTable() {
+  for (std::size_t i = 0; i < ALL_WORDS; ++i) {
+    const auto word = static_cast<uint16_t>(i);
+    if (Crc8(word) != Crc8Bitwise(word)) {
+      HOST_CHECK_EQ(Crc8(word), Crc8Bitwise(word));
+      return;
+    }
+  }
+}
+
+void checkBatch() {
+  const std::vector<uint16_t> words = allWords();
+  std::vector<uint8_t> crcs(ALL_WORDS);
+  Crc8Batch(words.data(), crcs.data(), ALL_WORDS);
+  std::size_t wrong = 0;
+  for (std::size_t i = 0; i < ALL_WORDS; ++i) {
+    wrong += static_cast<std::size_t>(crcs[i] != Crc8Bitwise(words[i]));
+  }
+  HOST_CHECK_EQ(wrong, 0);
+
+  // Every length up to a few SIMD blocks, at every start offset within a block: covers the
+  // vector body, the scalar tail and unaligned loads.
+  for (std::size_t offset = 0; offset < 16; ++offset) {
+    for (std::size_t count = 0; count <= 70; ++count) {
+      std::vector<uint8_t> out(count + 1, 0xA5);
+      Crc8Batch(words.data() + 0x1234 + offset, out.data(), count);
+      for (std::size_t i = 0; i < count; ++i) {
+        wrong += static_cast<std::size_t>(out[i] != Crc8Bitwise(words[0x1234 + offset + i]));
+      }
+      wrong += static_cast<std::size_t>(out[count] != 0xA5); // nothing written past the end
+    }
+  }
+  HOST_CHECK_EQ(wrong, 0);
+}
+
+void checkVerifyBatch() {
+  const std::vector<uint16_t> words = allWords();
+  std::vector<uint8_t> crcs(ALL_WORDS);
+  for (std::size_t i = 0; i < ALL_WORDS; ++i) {
+    crcs[i] = Crc8Bitwise(words[i]);
+  }
+  std::vector<uint8_t> mismatch(ALL_WORDS, 0xFF);
+  HOST_CHECK_EQ(Crc8VerifyBatch(words.data(), crcs.data(), ALL_WORDS, mismatch.data()), 0);
+  std::size_t flagged = 0;
+  for (const uint8_t m : mismatch) {
+    flagged += m;
+  }
+  HOST_CHECK_EQ(flagged, 0);
+
+  // Corrupt every 997th CRC: exactly those words are flagged
+  std::size_t corrupted = 0;
+  for (std::size_t i = 0; i < ALL_WORDS; i += 997) {
+    crcs[i] ^= 0x01;
+    ++corrupted;
+  }
+  HOST_CHECK_EQ(Crc8VerifyBatch(words.data(), crcs.data(), ALL_WORDS, mismatch.data()), corrupted);
+  std::size_t wrong = 0;
+  for (std::size_t i = 0; i < ALL_WORDS; ++i) {
+    wrong += static_cast<std::size_t>(mismatch[i] != ((i % 997) == 0 ? 1U : 0U));
+  }
+  HOST_CHECK_EQ(wrong, 0);
+  HOST_CHECK_EQ(Crc8VerifyBatch(words.data(), crcs.data(), ALL_WORDS), corrupted);
+}
+
+/// An AVX2 build may land on a host without AVX2; skip instead of faulting.
+bool backendRunsHere() {
+#if defined(AS5047U_CRC8_SIMD_AVX2) && defined(__GNUC__)
+  return __builtin_cpu_supports("avx2") != 0;
+#else
+  return true;
+#endif
+}
+
+} // namespace
+
+int main() {
+  if (!backendRunsHere()) {
+    std::printf("test_crc (%s): backend not supported by this CPU, skipped\n", CRC8_BATCH_BACKEND);
+    return 0;
+  }
+  std::printf("CRC8 batch backend: %s\n", CRC8_BATCH_BACKEND);
+  checkKnownFrames();
+  checkTable();
+  checkBatch();
+  checkVerifyBatch();
+  return HostTestResult("test_crc");
+}
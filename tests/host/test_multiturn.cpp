@@ -0,0 +1,173 @@
+/**
+ * @file test_multiturn.cpp
+ * @brief Host checks of MultiTurnCounter accumulation, glitch rejection and resync
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ */
+#include "as5047u_multiturn.hpp"
+#include "host_test.hpp"
+#include <array>
+#include <span>
+#include <vector>
+
+using namespace as5047u;
+
+namespace {
+
+constexpr int64_t TURN = MultiTurnCounter::COUNTS_PER_TURN;
+
+uint16_t wrapAngle(int64_t position) {
+  return static_cast<uint16_t>(position & (TURN - 1));
+}
+
+/// 0x3FFF -> 0 is one LSB forward, 0 -> 0x3FFF one LSB back.
+void checkWrap() {
+  MultiTurnCounter counter;
+  counter.Update(0x3FFF);
+  HOST_CHECK_EQ(counter.GetPosition(), 0x3FFF);
+  counter.Update(0);
+  HOST_CHECK_EQ(counter.GetPosition(), TURN);
+  HOST_CHECK_EQ(counter.GetTurns(), 1);
+  HOST_CHECK_EQ(counter.GetAngle(), 0);
+  counter.Update(0x3FFF);
+  HOST_CHECK_EQ(counter.GetPosition(), TURN - 1);
+  HOST_CHECK_EQ(counter.GetTurns(), 0);
+}
+
+/// Many turns in both directions, below half a turn per sample; turns floor for negatives.
+void checkAccumulation() {
+  MultiTurnCounter counter;
+  int64_t truth = 100;
+  counter.Update(wrapAngle(truth));
+  for (int i = 0; i < 5000; ++i) {
+    truth += 3001;
+    counter.Update(wrapAngle(truth));
+  }
+  HOST_CHECK_EQ(counter.GetPosition(), truth);
+  for (int i = 0; i < 12000; ++i) {
+    truth -= 2999;
+    counter.Update(wrapAngle(truth));
+  }
+  HOST_CHECK(truth < 0);
+  HOST_CHECK_EQ(counter.GetPosition(), truth);
+  HOST_CHECK_EQ(counter.GetTurns(), (truth - (TURN - 1)) / TURN); // floor division
+  HOST_CHECK_EQ(counter.GetAngle(), wrapAngle(truth));
+  HOST_CHECK_EQ(counter.TakeRejected(), 0);
+}
+
+/// Without a bound every step up to half a turn counts; exactly half a turn counts backwards.
+void checkHalfTurn() {
+  MultiTurnCounter counter;
+  counter.Update(0);
+  counter.Update(0x1FFF);
+  HOST_CHECK_EQ(counter.GetPosition(), 0x1FFF);
+  counter.Update(0);
+  HOST_CHECK_EQ(counter.GetPosition(), 0);
+  counter.Update(0x2000);
+  HOST_CHECK_EQ(counter.GetPosition(), -0x2000);
+  HOST_CHECK_EQ(counter.TakeRejected(), 0);
+}
+
+/// One wild sample is dropped and the next good one continues from the last accepted angle.
+void checkGlitchRejected() {
+  MultiTurnCounter counter(100);
+  counter.Update(1000);
+  counter.Update(1050);
+  counter.Update(9000); // glitch
+  HOST_CHECK_EQ(counter.GetPosition(), 1050);
+  counter.Update(1100);
+  HOST_CHECK_EQ(counter.GetPosition(), 1100);
+  HOST_CHECK_EQ(counter.TakeRejected(), 1);
+  HOST_CHECK_EQ(counter.TakeRejected(), 0);
+}
+
+/// A real move beyond max_step is followed after resync_after rejections.
+void checkResyncAfterRealMove() {
+  MultiTurnCounter counter(100);
+  counter.Update(50);
+  int64_t truth = 50 + 500; // shaft jumps (e.g. a bump while the loop was stalled)
+  counter.Update(wrapAngle(truth));
+  for (int i = 0; i < 20; ++i) {
+    truth += 50;
+    counter.Update(wrapAngle(truth));
+  }
+  HOST_CHECK_EQ(truth, 1550);
+  HOST_CHECK_EQ(counter.GetPosition(), 1550);
+  HOST_CHECK_EQ(counter.TakeRejected(), MultiTurnCounter::DEFAULT_RESYNC);
+}
+
+/// Block updates give the same result as sample-by-sample updates.
+void checkSpanMatchesSingle() {
+  std::vector<uint16_t> angles;
+  int64_t truth = 16000;
+  for (int i = 0; i < 1000; ++i) {
+    truth += (i % 7 == 3) ? 5000 : ((i % 2) != 0 ? 90 : -40); // glitch-sized steps mixed in
+    angles.push_back(wrapAngle(truth));
+  }
+  MultiTurnCounter single(200, 2);
+  for (const uint16_t angle : angles) {
+    single.Update(angle);
+  }
+  MultiTurnCounter block(200, 2);
+  block.Update(std::span<const uint16_t>(angles.data(), 400));
+  block.Update(std::span<const uint16_t>(angles.data() + 400, angles.size() - 400));
+  HOST_CHECK_EQ(block.GetPosition(), single.GetPosition());
+  HOST_CHECK_EQ(block.TakeRejected(), single.TakeRejected());
+}
+
+/// Sampler records with a communication error are counted as rejected and never move the position.
+void checkCommErrorSamples() {
+  MultiTurnCounter counter(100, 1);
+  std::array<EncoderSample, 6> samples{};
+  samples[0].angle = 500;
+  samples[0].errors = AS5047U_Error::CrcError; // before the first good sample
+  samples[1].angle = 1000;
+  samples[2].angle = 1040;
+  samples[3].angle = 7000;
+  samples[3].errors = AS5047U_Error::ResponseCrcError;
+  samples[4].angle = 9000;
+  samples[4].errors = AS5047U_Error::FramingError;
+  samples[5].angle = 1080;
+  counter.Update(std::span<const EncoderSample>(samples));
+  HOST_CHECK_EQ(counter.GetPosition(), 1080);
+  HOST_CHECK_EQ(counter.TakeRejected(), 3);
+
+  // Bad samples do not count towards a resync: with resync_after = 1 a real jump needs one
+  // plausible rejection, not a comm error
+  EncoderSample bad{};
+  bad.angle = 5000;
+  bad.errors = AS5047U_Error::CrcError;
+  counter.Update(bad);
+  EncoderSample jump{};
+  jump.angle = 5000;
+  counter.Update(jump);
+  HOST_CHECK_EQ(counter.GetPosition(), 1080);
+  counter.Update(jump);
+  HOST_CHECK_EQ(counter.GetPosition(), 5000);
+}
+
+void checkSetPositionAndReset() {
+  MultiTurnCounter counter;
+  counter.Update(300);
+  counter.Update(400);
+  counter.SetPosition(-5 * TURN);
+  counter.Update(500);
+  HOST_CHECK_EQ(counter.GetPosition(), (-5 * TURN) + 100);
+  HOST_CHECK_EQ(counter.GetTurns(), -5);
+  counter.Reset();
+  counter.Update(42);
+  HOST_CHECK_EQ(counter.GetPosition(), 42);
+}
+
+} // namespace
+
+int main() {
+  checkWrap();
+  checkAccumulation();
+  checkHalfTurn();
+  checkGlitchRejected();
+  checkResyncAfterRealMove();
+  checkSpanMatchesSingle();
+  checkCommErrorSamples();
+  checkSetPositionAndReset();
+  return HostTestResult("test_multiturn");
+}
@@ -0,0 +1,129 @@
+/**
+ * @file test_observer.cpp
+ * @brief Host checks of VelocityObserver and VelocityObserverQ convergence
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ *
+ * Both observers are fed an ideal constant-speed angle ramp (forward, backward,
+ * across the 16383 -> 0 wrap many times) and must settle on the true speed with
+ * the angle estimate locked to the input. A sample carrying a communication
+ * error must only advance the prediction.
+ */
+#include "as5047u_observer.hpp"
+#include "host_test.hpp"
+#include <array>
+#include <cmath>
+#include <span>
+
+using namespace as5047u;
+
+namespace {
+
+constexpr float RATE_HZ = 10000.0F;
+constexpr float BANDWIDTH_HZ = 200.0F;
+constexpr int SETTLE_SAMPLES = 4000; // many loop time constants at 200 Hz
+constexpr uint16_t TURN = 16384;
+
+uint16_t rampAngle(int start, int lsb_per_sample, int k) {
+  const long position = start + (static_cast<long>(lsb_per_sample) * k);
+  return static_cast<uint16_t>(((position % TURN) + TURN) % TURN);
+}
+
+/// Signed shortest distance between two angles in LSB.
+float angleError(float estimate, uint16_t truth) {
+  float delta = estimate - static_cast<float>(truth);
+  if (delta >= TURN / 2.0F) {
+    delta -= TURN;
+  } else if (delta < -TURN / 2.0F) {
+    delta += TURN;
+  }
+  return delta;
+}
+
+bool near(float value, float expected, float tolerance) {
+  return std::fabs(value - expected) <= tolerance;
+}
+
+template <typename Observer>
+float angleOf(const Observer& observer) {
+  return static_cast<float>(observer.GetAngle());
+}
+
+/// Settle on a constant speed and compare angle and velocity with the ramp.
+template <typename Observer>
+void checkConvergence(int lsb_per_sample) {
+  Observer observer(RATE_HZ, BANDWIDTH_HZ);
+  constexpr int START = 16000; // wraps within the first samples either way
+  for (int k = 0; k < SETTLE_SAMPLES; ++k) {
+    observer.Update(rampAngle(START, lsb_per_sample, k));
+  }
+  const float expected_lsb_per_sec = static_cast<float>(lsb_per_sample) * RATE_HZ;
+  const float velocity = observer.GetVelocity(VelocityUnit::DegPerSec) * (16384.0F / 360.0F);
+  HOST_CHECK(near(velocity, expected_lsb_per_sec, std::fabs(expected_lsb_per_sec) * 0.002F + 1.0F));
+  HOST_CHECK(near(angleError(angleOf(observer), rampAngle(START, lsb_per_sample, SETTLE_SAMPLES - 1)),
+                  0.0F, 1.0F));
+
+  // The other units are the same velocity scaled
+  const float deg_per_sec = observer.GetVelocity(VelocityUnit::DegPerSec);
+  HOST_CHECK(near(observer.GetVelocity(VelocityUnit::Rpm), deg_per_sec / 6.0F,
+                  std::fabs(deg_per_sec) * 1e-5F + 1e-3F));
+  HOST_CHECK(near(observer.GetVelocity(VelocityUnit::Lsb), deg_per_sec / 24.141F,
+                  std::fabs(deg_per_sec) * 1e-5F + 1e-3F));
+}
+
+/// A corrupted sample advances the estimate by one period instead of pulling it to the bad angle.
+template <typename Observer>
+void checkCommErrorOnlyPredicts() {
+  constexpr int SPEED = 25;
+  Observer observer(RATE_HZ, BANDWIDTH_HZ);
+  int k = 0;
+  for (; k < SETTLE_SAMPLES; ++k) {
+    observer.Update(rampAngle(100, SPEED, k));
+  }
+  EncoderSample bad{};
+  bad.angle = static_cast<uint16_t>(rampAngle(100, SPEED, k) ^ 0x2000); // half a turn off
+  bad.errors = AS5047U_Error::ResponseCrcError;
+  observer.Update(bad);
+  HOST_CHECK(near(angleError(angleOf(observer), rampAngle(100, SPEED, k)), 0.0F, 1.5F));
+  ++k;
+
+  // Clean sampler records behave like plain angles
+  EncoderSample good{};
+  good.angle = rampAngle(100, SPEED, k);
+  const std::array<EncoderSample, 1> block{good};
+  observer.Update(std::span<const EncoderSample>(block));
+  HOST_CHECK(near(angleError(angleOf(observer), good.angle), 0.0F, 1.5F));
+}
+
+void checkFixedPointVelocity() {
+  VelocityObserverQ observer(RATE_HZ, BANDWIDTH_HZ);
+  for (int k = 0; k < SETTLE_SAMPLES; ++k) {
+    observer.Update(rampAngle(0, -41, k));
+  }
+  HOST_CHECK(std::abs(observer.GetVelocityLsbPerSec() - (-41 * static_cast<int>(RATE_HZ))) <= 10);
+  HOST_CHECK_EQ(observer.GetAngle(), rampAngle(0, -41, SETTLE_SAMPLES - 1));
+}
+
+void checkReset() {
+  VelocityObserver observer(RATE_HZ, BANDWIDTH_HZ, 1.0F);
+  for (int k = 0; k < 100; ++k) {
+    observer.Update(rampAngle(0, 10, k));
+  }
+  observer.Reset();
+  observer.Update(1234);
+  HOST_CHECK(near(observer.GetAngle(), 1234.0F, 0.0F));
+  HOST_CHECK(near(observer.GetVelocity(), 0.0F, 0.0F));
+}
+
+} // namespace
+
+int main() {
+  for (const int speed : {1, 37, -53, 700, -1500}) {
+    checkConvergence<VelocityObserver>(speed);
+    checkConvergence<VelocityObserverQ>(speed);
+  }
+  checkCommErrorOnlyPredicts<VelocityObserver>();
+  checkCommErrorOnlyPredicts<VelocityObserverQ>();
+  checkFixedPointVelocity();
+  checkReset();
+  return HostTestResult("test_observer");
+}
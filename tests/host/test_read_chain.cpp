@@ -0,0 +1,128 @@
+/**
+ * @file test_read_chain.cpp
+ * @brief Host checks of ReadRegs() chaining against the simulated device
+ * @copyright Copyright (c) 2024-2025 HardFOC. All rights reserved.
+ *
+ * ReadRegs<...>() sends every read command in the frame that returns the
+ * previous response: N registers cost N+1 frames in ErrorCheckMode::InFrame
+ * and N+2 in ErrorCheckMode::ReadErrfl, as one frame list on a bus with
+ * transfer_frames().
+ */
+#include "as5047u.hpp"
+#include "host_test.hpp"
+#include "sim_as5047u.hpp"
+
+using namespace as5047u;
+using as5047u::test::SimBus;
+
+namespace {
+
+constexpr uint16_t ANGLE = 0x1234;
+constexpr uint16_t VEL = 0x3FF0; // -16 LSB
+constexpr uint16_t MAG = 0x0ABC;
+constexpr uint16_t AGC = 0x0080;
+
+void loadDevice(SimBus& bus) {
+  bus.device.Reg(AS5047U_REG::ANGLECOM::ADDRESS) = ANGLE;
+  bus.device.Reg(AS5047U_REG::VEL::ADDRESS) = VEL;
+  bus.device.Reg(AS5047U_REG::MAG::ADDRESS) = MAG;
+  bus.device.Reg(AS5047U_REG::AGC::ADDRESS) = AGC;
+}
+
+uint16_t stickyBits(const AS5047U<SimBus>& encoder) {
+  return static_cast<uint16_t>(encoder.GetStickyErrorFlags());
+}
+
+/// Values, frame count and bus calls of a four-register chain in every format and mode.
+void checkChain(FrameFormat format, ErrorCheckMode mode) {
+  SimBus bus;
+  loadDevice(bus);
+  AS5047U<SimBus> encoder(bus, format);
+  encoder.SetErrorCheckMode(mode);
+
+  const auto [angle, vel, mag, agc] =
+      encoder.ReadRegs<AS5047U_REG::ANGLECOM, AS5047U_REG::VEL, AS5047U_REG::MAG,
+                       AS5047U_REG::AGC>();
+  HOST_CHECK_EQ(angle.value, ANGLE);
+  HOST_CHECK_EQ(vel.value, VEL);
+  HOST_CHECK_EQ(mag.value, MAG);
+  HOST_CHECK_EQ(agc.value, AGC);
+  HOST_CHECK_EQ(bus.device.frames, mode == ErrorCheckMode::InFrame ? 5 : 6);
+  HOST_CHECK_EQ(bus.calls, 1);
+  HOST_CHECK_EQ(stickyBits(encoder), 0);
+}
+
+/// A single register is a command and one closing frame.
+void checkSingleRegister() {
+  SimBus bus;
+  loadDevice(bus);
+  AS5047U<SimBus> encoder(bus, FrameFormat::SPI_24);
+  encoder.SetErrorCheckMode(ErrorCheckMode::InFrame);
+  const auto [agc] = encoder.ReadRegs<AS5047U_REG::AGC>();
+  HOST_CHECK_EQ(agc.value, AGC);
+  HOST_CHECK_EQ(bus.device.frames, 2);
+}
+
+/// All six configuration registers in one chain keep their order.
+void checkConfigChain() {
+  SimBus bus;
+  const uint16_t base = 0x0100;
+  for (uint16_t address = AS5047U_REG::DISABLE::ADDRESS; address <= AS5047U_REG::SETTINGS3::ADDRESS;
+       ++address) {
+    bus.device.Reg(address) = static_cast<uint16_t>(base + address);
+  }
+  AS5047U<SimBus> encoder(bus, FrameFormat::SPI_32);
+  const auto [dis, zposm, zposl, s1, s2, s3] =
+      encoder.ReadRegs<AS5047U_REG::DISABLE, AS5047U_REG::ZPOSM, AS5047U_REG::ZPOSL,
+                       AS5047U_REG::SETTINGS1, AS5047U_REG::SETTINGS2, AS5047U_REG::SETTINGS3>();
+  HOST_CHECK_EQ(dis.value, base + AS5047U_REG::DISABLE::ADDRESS);
+  HOST_CHECK_EQ(zposm.value, base + AS5047U_REG::ZPOSM::ADDRESS);
+  HOST_CHECK_EQ(zposl.value, base + AS5047U_REG::ZPOSL::ADDRESS);
+  HOST_CHECK_EQ(s1.value, base + AS5047U_REG::SETTINGS1::ADDRESS);
+  HOST_CHECK_EQ(s2.value, base + AS5047U_REG::SETTINGS2::ADDRESS);
+  HOST_CHECK_EQ(s3.value, base + AS5047U_REG::SETTINGS3::ADDRESS);
+}
+
+/// In-frame mode fetches ERRFL only when a response carries a status bit.
+void checkStatusBitFetchesErrfl() {
+  SimBus bus;
+  loadDevice(bus);
+  bus.device.errfl = static_cast<uint16_t>(AS5047U_Error::MagHalf);
+  AS5047U<SimBus> encoder(bus, FrameFormat::SPI_24);
+  encoder.SetErrorCheckMode(ErrorCheckMode::InFrame);
+  const auto [angle, vel] = encoder.ReadRegs<AS5047U_REG::ANGLECOM, AS5047U_REG::VEL>();
+  HOST_CHECK_EQ(angle.value, ANGLE);
+  HOST_CHECK_EQ(vel.value, VEL);
+  HOST_CHECK_EQ(bus.device.frames, 3 + 2); // chain, then ERRFL command + NOP
+  HOST_CHECK_EQ(stickyBits(encoder), static_cast<uint16_t>(AS5047U_Error::MagHalf));
+  HOST_CHECK_EQ(bus.device.errfl, 0);
+}
+
+/// A corrupted MISO CRC anywhere in the chain is reported as ResponseCrcError.
+void checkResponseCrc() {
+  for (long corrupt = 1; corrupt <= 4; ++corrupt) {
+    SimBus bus;
+    loadDevice(bus);
+    bus.device.corrupt_frame = corrupt;
+    AS5047U<SimBus> encoder(bus, FrameFormat::SPI_24);
+    encoder.SetErrorCheckMode(ErrorCheckMode::InFrame);
+    (void)encoder.ReadRegs<AS5047U_REG::ANGLECOM, AS5047U_REG::VEL, AS5047U_REG::MAG,
+                           AS5047U_REG::AGC>();
+    HOST_CHECK((stickyBits(encoder) & static_cast<uint16_t>(AS5047U_Error::ResponseCrcError)) !=
+               0U);
+  }
+}
+
+} // namespace
+
+int main() {
+  for (const FrameFormat format : {FrameFormat::SPI_16, FrameFormat::SPI_24, FrameFormat::SPI_32}) {
+    checkChain(format, ErrorCheckMode::InFrame);
+    checkChain(format, ErrorCheckMode::ReadErrfl);
+  }
+  checkSingleRegister();
+  checkConfigChain();
+  checkStatusBitFetchesErrfl();
+  checkResponseCrc();
+  return HostTestResult("test_read_chain");
+}